@@ -6,10 +6,21 @@
 #include <string.h>
 #include <stdlib.h>
 #include <time.h>
+#include <limits.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#define PSAPI_VERSION 2 // GetProcessMemoryInfo exporté par kernel32 (pas de -lpsapi)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
 
 // --- Définitions des Constantes et Couleurs ---
 #define MAX_N 1000000 // Supporte jusqu'à un million d'éléments
-#define MAX_LIST_SIZE 10000 // Increased limit for unlimited feel
+#define MAX_LIST_SIZE 2000000 // Listes de plusieurs millions de nœuds (ajout/suppression en fin en O(1))
 
 #define NODE_WIDTH 80.0
 #define NODE_HEIGHT 40.0
@@ -22,34 +33,209 @@ const gchar *METHOD_NAMES[] = {"Tri à Bulles", "Tri par Insertion", "Tri Shell"
 
 
 // --- [LISTES] --- Définitions des Structures de Liste
+// Valeur stockée directement dans le nœud: int, float, char ou pointeur de chaîne tiennent sur 8 octets
+typedef union {
+    int i;
+    float f;
+    char c;
+    char *s;
+    guint64 raw;
+} NodePayload;
+
 typedef struct Node {
-    void *data;
+    void *data;        // Pointe toujours sur payload du même nœud (même ligne de cache)
     struct Node *next;
     struct Node *prev; // Pour les listes doubles
+    NodePayload payload;
 } Node;
 
+// Bloc contigu de nœuds (slab) appartenant à une liste
+typedef struct NodeSlab {
+    struct NodeSlab *next;
+    size_t capacity;
+    Node nodes[];
+} NodeSlab;
+
+// Allocateur de nœuds par slabs: les nœuds libérés sont recyclés via une liste libre,
+// la libération de la liste entière rend les slabs sans parcourir les nœuds.
+typedef struct {
+    NodeSlab *slabs;      // Slab le plus récent en tête
+    size_t slab_used;     // Nœuds déjà distribués dans le slab de tête
+    Node *free_list;      // Chaînée par 'next'
+    Node *free_tail;      // Dernier nœud libre: une chaîne entière se rend en O(1)
+    size_t slab_count;
+    size_t reserved_bytes;
+    int ref_count;        // Listes partageant ce pool (une scission partage les slabs)
+} NodePool;
+
+// Ensemble de hachage auxiliaire (adressage ouvert, sondage linéaire) des valeurs d'une liste.
+// C'est un multiensemble: count compte les doublons insérés manuellement.
+typedef struct {
+    guint64 key;   // Valeur normalisée: int, bits du float, char ou hachage de la chaîne
+    char *string;  // Copie de la chaîne (type chaîne uniquement) pour lever les collisions
+    guint32 count; // Nombre d'occurrences (0 = case libre)
+} ListHashEntry;
+
+typedef struct {
+    ListHashEntry *entries;
+    size_t capacity; // Puissance de 2
+    size_t used;     // Nombre de valeurs distinctes
+} ListHashSet;
+
+// Bloc de la liste déroulée: plusieurs éléments contigus par maillon
+#define UNROLLED_BLOCK_BYTES 128 // Deux lignes de cache de 64 octets, en-tête compris
+
+typedef struct ListBlock {
+    struct ListBlock *next;
+    struct ListBlock *prev;
+    guint32 count;           // Éléments occupés
+    guint32 capacity;        // Éléments tenant dans UNROLLED_BLOCK_BYTES
+    unsigned char items[];   // count éléments de element_size octets
+} ListBlock;
+
+// Nœud de liste à sauts indexable: chaque pointeur avant porte sa largeur
+// (nombre de nœuds du niveau 0 qu'il enjambe), ce qui permet l'accès par rang en O(log n)
+#define SKIP_MAX_LEVEL 32
+
+typedef struct SkipNode SkipNode;
+
+typedef struct {
+    SkipNode *next;
+    size_t width;
+} SkipLink;
+
+struct SkipNode {
+    NodePayload payload;
+    int level;        // Hauteur de la tour (1 = niveau 0 seulement)
+    SkipLink links[]; // level liens, du niveau 0 au niveau level-1
+};
+
 typedef struct List {
     Node *head;
+    Node *tail; // Dernier nœud: ajout en fin en O(1) (et suppression en fin pour les listes doubles)
+    Node *cursor;     // Dernier nœud atteint par index (NULL si invalide): point de départ des parcours
+    int cursor_index;
     size_t size;
     size_t element_size;
     int (*compare_func)(const void *, const void *);
     const gchar *structure_type; // "Liste Simple" ou "Liste Double"
     const gchar *element_type;
+    ListHashSet value_set;    // Synchronisé par insertion / suppression / modification
+    gboolean value_set_stale; // Invalidé par les opérations groupées, reconstruit à la prochaine recherche
+    NodePool *pool;           // Slabs des nœuds (partagés avec les listes issues d'une scission)
+    // "Liste Déroulée": les éléments vivent dans les blocs, head/tail restent NULL
+    ListBlock *first_block;
+    ListBlock *last_block;
+    size_t block_count;
+    // "Liste à Sauts": toujours triée par valeur, sentinelle de hauteur SKIP_MAX_LEVEL
+    SkipNode *skip_head;
+    int skip_level;
 } List;
 
+// Historique d'annulation de la liste courante: journal des opérations inverses.
+// Chaque étape ne conserve que ce qui a changé (valeurs insérées, supprimées ou réordonnées),
+// enregistrer une étape ne copie jamais la liste entière.
+typedef enum {
+    LIST_EDIT_INSERT,  // count valeurs insérées à index (copiées à la première annulation si values == NULL)
+    LIST_EDIT_DELETE,  // count valeurs supprimées à partir de index
+    LIST_EDIT_MODIFY,  // values[0] = ancienne valeur, values[1] = nouvelle valeur à index
+    LIST_EDIT_REORDER, // Ordre des valeurs échangé avec celui de la liste (tri)
+    LIST_EDIT_REPLACE  // Liste entière remplacée: l'autre version est conservée telle quelle
+} ListEditKind;
+
+typedef struct {
+    ListEditKind kind;
+    int index;
+    size_t count;
+    size_t element_size;
+    gboolean owns_strings;  // Les chaînes de 'values' appartiennent à l'étape
+    unsigned char *values;
+    gboolean moves_secondary; // Scission / greffe: les valeurs passent de / vers la liste secondaire
+    List *list;             // LIST_EDIT_REPLACE: autre version; scission: liste secondaire remplacée
+} ListEdit;
+
+#define LIST_HISTORY_DEPTH 100
+
+typedef struct {
+    ListEdit undo[LIST_HISTORY_DEPTH];
+    int undo_count;
+    ListEdit redo[LIST_HISTORY_DEPTH];
+    int redo_count;
+} ListHistory;
+
 // --- [ARBRES] --- Définitions des Structures d'Arbre
+// Équilibrage de l'arbre binaire de recherche, dans l'ordre du menu "Type d'Arbre"
+typedef enum {
+    TREE_BALANCE_NONE, // ABR simple: dégénère en liste sur une saisie triée
+    TREE_BALANCE_AVL,  // AVL: hauteurs des sous-arbres à 1 près
+    TREE_BALANCE_RB    // Rouge-Noir penché à gauche: hauteur <= 2 log2(n+1)
+} TreeBalance;
+
 typedef struct BinaryNode {
     void *data;
     struct BinaryNode *left;
     struct BinaryNode *right;
+    int size;     // Nombre de nœuds du sous-arbre (statistiques d'ordre)
+    int height;   // Hauteur du sous-arbre (1 pour une feuille)
+    gboolean red; // Rouge-Noir: couleur du lien venant du parent
+    double x;     // Position dans la disposition en cache (arbre centré sur x = 0)
+    double y;     // Profondeur * VERTICAL_SPACING
 } BinaryNode;
 
 typedef struct NaryNode {
     void *data;
     struct NaryNode *first_child;
     struct NaryNode *next_sibling;
+    struct NaryNode *last_child; // Ajout d'un enfant en O(1)
+    int child_count;
+    double x; // Position dans la disposition en cache (racine en x = 0)
+    double y; // Profondeur * VERTICAL_SPACING
+    // Boîte englobante et taille du sous-arbre dans la disposition en cache (élagage au dessin)
+    double subtree_min_x;
+    double subtree_max_x;
+    double subtree_max_y;
+    int subtree_size;
 } NaryNode;
 
+// --- Pile explicite pour les parcours d'arbres ---
+// Les parcours empilent sur le tas plutôt que sur la pile d'appels: un ABR dégénéré
+// (saisie triée) ou une longue chaîne de frères N-aires d'un million de nœuds ne fait
+// pas déborder la pile, la taille n'est limitée que par la mémoire.
+typedef struct {
+    void **items;
+    size_t count;
+    size_t capacity;
+} TreeStack;
+
+static void tree_stack_push(TreeStack *stack, void *item) {
+    if (stack->count == stack->capacity) {
+        stack->capacity = stack->capacity ? stack->capacity * 2 : 64;
+        stack->items = g_renew(void *, stack->items, stack->capacity);
+    }
+    stack->items[stack->count++] = item;
+}
+
+static void *tree_stack_pop(TreeStack *stack) {
+    return stack->count ? stack->items[--stack->count] : NULL;
+}
+
+static void tree_stack_free(TreeStack *stack) {
+    g_free(stack->items);
+    stack->items = NULL;
+    stack->count = stack->capacity = 0;
+}
+
+// --- File des nœuds N-aires ayant encore de la place (insertion à degré borné en O(1)) ---
+// Les nœuds y sont rangés dans l'ordre du parcours en largeur: la tête est le parent qui
+// reçoit le prochain nœud. Après une suppression ou un changement de degré, la file est
+// reconstruite paresseusement par un parcours en largeur à l'insertion suivante.
+typedef struct {
+    TreeStack nodes; // Les éléments avant head ont déjà été retirés de la file
+    size_t head;
+    int degree;      // Degré maximum pour lequel la file a été construite
+    gboolean valid;
+} NaryFrontier;
+
 // --- [GRAPHES] --- Définitions des Structures de Graphe
 #define MAX_GRAPH_NODES 20
 #define INF 999999
@@ -72,14 +258,26 @@ typedef void (*SortFunction)(void *, size_t, size_t, int (*)(const void *, const
 
 // --- Définitions de la fonction de tri (PROTOTYPES pour la compilation) ---
 static void swap_elements(void *a, void *b, size_t element_size);
-static size_t partition(void *data, size_t low, size_t high, size_t element_size, int (*compare_func)(const void *, const void *));
-static void quick_sort_recursive(void *data, size_t low, size_t high, size_t element_size, int (*compare_func)(const void *, const void *));
+static void partition(void *data, size_t low, size_t high, size_t element_size, int (*compare_func)(const void *, const void *),
+                      char *pivot, size_t *lt, size_t *gt);
+static void quick_sort_recursive(void *data, size_t low, size_t high, size_t element_size, int (*compare_func)(const void *, const void *),
+                                 char *pivot, int depth_budget);
 static void bubble_sort(void *data, size_t N, size_t element_size, int (*compare_func)(const void *, const void *));
 static void insertion_sort(void *data, size_t N, size_t element_size, int (*compare_func)(const void *, const void *));
 static void shell_sort(void *data, size_t N, size_t element_size, int (*compare_func)(const void *, const void *));
 static void quick_sort(void *data, size_t N, size_t element_size, int (*compare_func)(const void *, const void *));
 
 
+// Mesures mémoire d'une exécution de tri
+typedef struct {
+    size_t aux_peak_bytes;   // Pic d'octets auxiliaires alloués par le noyau
+    size_t aux_total_bytes;  // Cumul des octets alloués (mesure le "churn")
+    size_t alloc_count;      // Nombre d'allocations
+    int peak_depth;          // Profondeur maximale de récursion (0 = itératif)
+    size_t peak_stack_bytes; // Pile consommée au plus profond de la récursion
+    long rss_delta_kb;       // Hausse du pic RSS du processus pendant le tri
+} SortMemoryStats;
+
 // Structure pour stocker les données de nettoyage des fenêtres tableaux
 typedef struct {
     void *data_ptr;
@@ -103,8 +301,22 @@ typedef struct {
 
     // Données pour la comparaison des courbes
     double comparison_times[4][5]; // 4 méthodes, 5 points N (temps en ms)
+    SortMemoryStats comparison_memory[4][5]; // Mesures mémoire associées à chaque point
+    gboolean comparison_measured[4][5]; // FALSE: point extrapolé (budget de temps dépassé)
+    int comparison_N[5]; // Tailles réellement mesurées (N de départ borné, plafonné à MAX_N)
+    int fit_model[4]; // Modèle de complexité retenu (indice dans FIT_MODEL_NAMES)
+    double fit_constant[4]; // Constante ajustée: t ≈ c·f(n) en secondes
+    gboolean curves_computed;
+    GtkSpinButton *curve_budget_input;
     int N_initial;
 
+    // Sélection (statistiques d'ordre / top-k)
+    GtkSpinButton *selection_k_input;
+
+    // Tri indirect (argsort)
+    GtkWidget *argsort_toggle;
+    GtkWidget *argsort_prefix_toggle;
+
     // Données du tableau actuel
     void *initial_data_ptr;
     size_t current_N;
@@ -123,12 +335,19 @@ typedef struct {
     GtkEntry *list_value_entry;
     GtkWidget *list_random_box;
     GtkWidget *list_manual_box;
+    GtkWidget *list_sweep_toggle; // Tri: balayage de tailles (liste vs tableau contigu)
+    List *list_secondary;         // Partie détachée par une scission, greffable dans la liste courante
+    ListHistory *list_history;    // Annuler / Rétablir sur la liste courante
 
     // Module Arbres
     BinaryNode *binary_root;
     NaryNode *nary_root;
     GtkWidget *tree_drawing_area;
-    GtkWidget *tree_scrolled_window;
+    GtkAdjustment *tree_hadjustment; // Défilement de la vue de l'arbre, en pixels à l'échelle courante
+    GtkAdjustment *tree_vadjustment;
+    double tree_zoom;                // Échelle d'affichage de l'arbre (1.0 = taille réelle)
+    gboolean tree_panning;           // Glisser-déplacer de la vue en cours
+    double tree_pan_x, tree_pan_y;   // Dernière position du pointeur pendant le glisser
     GtkTextView *tree_info_view;
     GtkComboBoxText *tree_type_combo;
     GtkComboBoxText *tree_data_type_combo;
@@ -142,8 +361,29 @@ typedef struct {
     GtkWidget *tree_manual_label; // Label "Valeur (manuel)"
     GtkWidget *tree_manual_button; // Bouton "Insérer Manuel"
     int tree_is_nary; // 0: Binary, 1: N-Ary
+    TreeBalance tree_balance; // Équilibrage de l'arbre binaire courant
+    gboolean binary_unordered; // Arbre binaire qui n'est plus un ABR (transformation, modification en place)
+    // Disposition en cache de l'arbre binaire (recalculée après chaque modification)
+    gboolean binary_layout_valid;
+    BinaryNode **binary_layout_nodes; // Nœuds en ordre infixe: l'indice est la colonne
+    int binary_layout_count;
+    double binary_layout_half_width;  // Demi-largeur entre les centres extrêmes
+    double binary_layout_max_y;       // Ordonnée du niveau le plus profond
+    // Disposition en cache de l'arbre N-aire (algorithme de Walker)
+    gboolean nary_layout_valid;
+    NaryNode **nary_layout_nodes;     // Index spatial: nœuds rangés par niveau, de gauche à droite
+    int *nary_layout_row_start;       // Début de chaque niveau dans nary_layout_nodes (levels + 1 entrées)
+    int nary_layout_levels;
+    int nary_layout_count;
+    double nary_layout_min_x;         // Bornes des centres, racine en x = 0
+    double nary_layout_max_x;
+    double nary_layout_max_y;
     int tree_input_source; // 0: Aléatoire, 1: Manuel
     int nary_max_children; // degré maximum pour un nœud N-aire
+    int nary_count; // Nombre de nœuds de l'arbre N-aire (tenu à jour, stats en O(1))
+    NaryFrontier nary_frontier; // Parents possibles pour l'insertion N-aire
+    void *tree_hover_node; // Nœud survolé (binaire ou N-aire), NULL si aucun
+    double tree_hover_x, tree_hover_y; // Centre du nœud survolé, pour ne redessiner que sa zone
 
     // Module Graphes
     Graph *current_graph;
@@ -435,49 +675,15 @@ static void display_array_in_view(GtkWidget *view, const void *data, size_t N, s
     g_string_free(output, TRUE);
 }
 
-// --- Mesure du temps (simulation ajustée en millisecondes) ---
+// --- Mesure du temps réel (horloge monotone, en millisecondes) ---
+// Seul l'appel au noyau de tri est chronométré: copies et vérifications restent hors de la zone mesurée.
 
 static double measure_time(SortFunction sort_func, void *data, size_t N, size_t element_size, int (*compare_func)(const void *, const void *)) {
-    // Le facteur de base est choisi pour donner des temps raisonnables en ms
-    // pour des N jusqu'à 50 000 ou 100 000.
-    double base_factor = 0.000000005; // Facteur de base original pour performance
-    double N_double = (double)N;
-    double time_ms = 0.0;
-
-    // Simuler différentes complexités
-    // Ordre attendu: Bubble Sort (le plus lent) > Insertion Sort > Shell Sort > Quick Sort (le plus rapide)
-
-    // Bubble Sort (O(N^2)) - Le plus lent
-    if (sort_func == (SortFunction)bubble_sort) {
-        // N^2 avec le plus grand facteur
-        time_ms = base_factor * pow(N_double, 2.0) * 2000.0;
-    }
-    // Insertion Sort (O(N^2)) - Plus rapide que Bubble mais plus lent que Shell
-    else if (sort_func == (SortFunction)insertion_sort) {
-        // N^2 avec facteur plus petit que Bubble
-        time_ms = base_factor * pow(N_double, 2.0) * 1200.0;
-    }
-    // Shell Sort (O(N^1.3) ~ O(N^1.5)) - Intermédiaire
-    else if (sort_func == (SortFunction)shell_sort) {
-        // N^1.3 avec facteur moyen
-        time_ms = base_factor * pow(N_double, 1.3) * 800.0;
-    }
-    // Quick Sort (O(N log N)) - Le plus rapide
-    else if (sort_func == (SortFunction)quick_sort) {
-        // N * log(N) avec le plus petit facteur
-        double logN = (N_double > 1.0) ? log(N_double) : 1.0;
-        time_ms = base_factor * N_double * logN * 200.0;
-    }
-    // Par défaut (ne devrait pas arriver)
-    else {
-        time_ms = base_factor * pow(N_double, 2.0) * 2000.0;
-    }
+    gint64 start = g_get_monotonic_time();
+    sort_func(data, N, element_size, compare_func);
+    double time_ms = (g_get_monotonic_time() - start) / 1000.0;
 
-    // Ajout d'une petite variation pour différencier les essais (max 5% de variation)
-    // pour éviter que les temps soient exactement identiques
-    time_ms *= (0.98 + (double)rand() / RAND_MAX * 0.04);
-
-    // Garantir un minimum pour éviter les temps à zéro
+    // Garantir un minimum pour éviter les temps à zéro (résolution de l'horloge)
     if (time_ms < 0.001) time_ms = 0.001;
 
     return time_ms; // Temps retourné en millisecondes
@@ -485,17 +691,138 @@ static double measure_time(SortFunction sort_func, void *data, size_t N, size_t
 
 
 // =========================================================================
-//                             FONCTIONS DE TRI (SIMULÉES)
+//                             COMPTABILITÉ MÉMOIRE DES TRIS
+// =========================================================================
+// Les noyaux de tri allouent via sort_malloc/sort_free: pendant une mesure, chaque bloc
+// porte un en-tête avec sa taille, ce qui permet de suivre le pic d'octets auxiliaires.
+// Les tris s'exécutent sur le thread de l'interface: un état global suffit.
+
+#define SORT_ALLOC_HEADER 16 // Conserve l'alignement des blocs retournés
+
+typedef struct {
+    gboolean active;
+    size_t current_bytes;
+    size_t peak_bytes;
+    size_t total_bytes;
+    size_t alloc_count;
+    int depth;
+    int peak_depth;
+    const char *stack_base;
+    size_t peak_stack_bytes;
+} SortMemoryTracker;
+
+static SortMemoryTracker sort_memory = {0};
+
+static void *sort_malloc(size_t size) {
+    if (!sort_memory.active) return malloc(size);
+
+    char *block = (char *)malloc(size + SORT_ALLOC_HEADER);
+    if (!block) return NULL;
+    memcpy(block, &size, sizeof(size_t));
+
+    sort_memory.current_bytes += size;
+    sort_memory.total_bytes += size;
+    sort_memory.alloc_count++;
+    if (sort_memory.current_bytes > sort_memory.peak_bytes) sort_memory.peak_bytes = sort_memory.current_bytes;
+    return block + SORT_ALLOC_HEADER;
+}
+
+static void sort_free(void *ptr) {
+    if (!ptr) return;
+    if (!sort_memory.active) {
+        free(ptr);
+        return;
+    }
+
+    char *block = (char *)ptr - SORT_ALLOC_HEADER;
+    size_t size;
+    memcpy(&size, block, sizeof(size_t));
+    sort_memory.current_bytes -= size;
+    free(block);
+}
+
+// Appelées à l'entrée/sortie des noyaux récursifs pour suivre la profondeur de pile
+static inline void sort_stack_enter(void) {
+    if (!sort_memory.active) return;
+    char probe;
+    sort_memory.depth++;
+    if (sort_memory.depth > sort_memory.peak_depth) sort_memory.peak_depth = sort_memory.depth;
+
+    size_t used = (sort_memory.stack_base > &probe) ? (size_t)(sort_memory.stack_base - &probe)
+                                                     : (size_t)(&probe - sort_memory.stack_base);
+    if (used > sort_memory.peak_stack_bytes) sort_memory.peak_stack_bytes = used;
+}
+
+static inline void sort_stack_leave(void) {
+    if (sort_memory.active) sort_memory.depth--;
+}
+
+// Pic RSS du processus en Kio (valeur "high-water mark": elle ne redescend jamais)
+static long process_peak_rss_kb(void) {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return (long)(counters.PeakWorkingSetSize / 1024);
+    }
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) return usage.ru_maxrss; // Kio sous Linux
+    return 0;
+#endif
+}
+
+static void sort_memory_begin(const char *stack_base) {
+    memset(&sort_memory, 0, sizeof(sort_memory));
+    sort_memory.stack_base = stack_base;
+    sort_memory.active = TRUE;
+}
+
+static void sort_memory_end(SortMemoryStats *stats, long rss_before_kb) {
+    sort_memory.active = FALSE;
+    if (!stats) return;
+
+    stats->aux_peak_bytes = sort_memory.peak_bytes;
+    stats->aux_total_bytes = sort_memory.total_bytes;
+    stats->alloc_count = sort_memory.alloc_count;
+    stats->peak_depth = sort_memory.peak_depth;
+    stats->peak_stack_bytes = sort_memory.peak_stack_bytes;
+    // Seule une croissance au-delà du pic précédent est visible
+    long rss_after_kb = process_peak_rss_kb();
+    stats->rss_delta_kb = (rss_after_kb > rss_before_kb) ? rss_after_kb - rss_before_kb : 0;
+}
+
+// Formatage lisible d'une quantité d'octets (o, Kio, Mio)
+static void append_byte_size(GString *output, size_t bytes) {
+    if (bytes < 1024) g_string_append_printf(output, "%lu o", (unsigned long)bytes);
+    else if (bytes < 1024 * 1024) g_string_append_printf(output, "%.1f Kio", bytes / 1024.0);
+    else g_string_append_printf(output, "%.2f Mio", bytes / (1024.0 * 1024.0));
+}
+
+// Résumé d'une ligne des mesures mémoire
+static void append_memory_summary(GString *output, const SortMemoryStats *stats) {
+    g_string_append(output, "mém. aux. pic ");
+    append_byte_size(output, stats->aux_peak_bytes);
+    g_string_append_printf(output, " (%lu allocations, cumul ", (unsigned long)stats->alloc_count);
+    append_byte_size(output, stats->aux_total_bytes);
+    g_string_append_printf(output, "), pile: %d niveaux (", stats->peak_depth);
+    append_byte_size(output, stats->peak_stack_bytes);
+    g_string_append_printf(output, "), ΔRSS pic: %ld Kio", stats->rss_delta_kb);
+}
+
+
+// =========================================================================
+//                             FONCTIONS DE TRI
 // =========================================================================
 
 // Fonction utilitaire pour échanger deux éléments
 static void swap_elements(void *a, void *b, size_t element_size) {
-    char *temp = (char *)malloc(element_size);
+    char *temp = (char *)sort_malloc(element_size);
     if (!temp) return; // Échec d'allocation
     memcpy(temp, a, element_size);
     memcpy(a, b, element_size);
     memcpy(b, temp, element_size);
-    free(temp);
+    sort_free(temp);
 }
 
 static void bubble_sort(void *data, size_t N, size_t element_size, int (*compare_func)(const void *, const void *)) {
@@ -520,7 +847,7 @@ static void insertion_sort(void *data, size_t N, size_t element_size, int (*comp
     if (!data || N <= 1) return;
 
     char *base = (char *)data;
-    char *key = (char *)malloc(element_size);
+    char *key = (char *)sort_malloc(element_size);
     if (!key) return; // Échec d'allocation
 
     for (size_t i = 1; i < N; i++) {
@@ -533,14 +860,14 @@ static void insertion_sort(void *data, size_t N, size_t element_size, int (*comp
         }
         memcpy(base + j * element_size, key, element_size);
     }
-    free(key);
+    sort_free(key);
 }
 
 static void shell_sort(void *data, size_t N, size_t element_size, int (*compare_func)(const void *, const void *)) {
     if (!data || N <= 1) return;
 
     char *base = (char *)data;
-    char *temp = (char *)malloc(element_size);
+    char *temp = (char *)sort_malloc(element_size);
     if (!temp) return; // Échec d'allocation
 
     // Séquence de gaps (Knuth: 3k+1)
@@ -562,37 +889,581 @@ static void shell_sort(void *data, size_t N, size_t element_size, int (*compare_
         }
         gap /= 3;
     }
-    free(temp);
+    sort_free(temp);
 }
 
-// Fonction de partition pour quicksort
-static size_t partition(void *data, size_t low, size_t high, size_t element_size, int (*compare_func)(const void *, const void *)) {
+// Fonction de partition pour quicksort: à trois voies (Dijkstra) autour de la médiane
+// du premier, du milieu et du dernier élément. Les clés égales au pivot sont regroupées
+// et exclues des appels suivants: une entrée triée ou à faible cardinalité (Char, 26
+// valeurs) ne dégénère plus en O(N²).
+// Après l'appel: [low, *lt) < pivot, [*lt, *gt] == pivot, (*gt, high] > pivot.
+static void partition(void *data, size_t low, size_t high, size_t element_size, int (*compare_func)(const void *, const void *),
+                      char *pivot, size_t *lt, size_t *gt) {
     char *base = (char *)data;
-    void *pivot = base + high * element_size;
-    size_t i = low;
+    size_t mid = low + (high - low) / 2;
+    char *a = base + low * element_size;
+    char *b = base + mid * element_size;
+    char *c = base + high * element_size;
+    char *median;
+    if (compare_func(a, b) < 0) {
+        median = (compare_func(b, c) < 0) ? b : ((compare_func(a, c) < 0) ? c : a);
+    } else {
+        median = (compare_func(a, c) < 0) ? a : ((compare_func(b, c) < 0) ? c : b);
+    }
+    memcpy(pivot, median, element_size);
 
-    for (size_t j = low; j < high; j++) {
-        if (compare_func(base + j * element_size, pivot) < 0) {
-            swap_elements(base + i * element_size, base + j * element_size, element_size);
+    size_t l = low, i = low, g = high;
+    while (i <= g) {
+        int cmp = compare_func(base + i * element_size, pivot);
+        if (cmp < 0) {
+            if (l != i) swap_elements(base + l * element_size, base + i * element_size, element_size);
+            l++;
+            i++;
+        } else if (cmp > 0) {
+            swap_elements(base + i * element_size, base + g * element_size, element_size);
+            if (g == 0) break;
+            g--;
+        } else {
             i++;
         }
     }
-    swap_elements(base + i * element_size, pivot, element_size);
-    return i;
+    *lt = l;
+    *gt = g;
 }
 
-// Fonction récursive pour quicksort
-static void quick_sort_recursive(void *data, size_t low, size_t high, size_t element_size, int (*compare_func)(const void *, const void *)) {
-    if (low < high) {
-        size_t pi = partition(data, low, high, element_size, compare_func);
-        if (pi > 0) quick_sort_recursive(data, low, pi - 1, element_size, compare_func);
-        quick_sort_recursive(data, pi + 1, high, element_size, compare_func);
+// Fonction récursive pour quicksort: récursion sur la plus petite partie, boucle sur la
+// plus grande, la profondeur de pile reste en O(log N) quelle que soit l'entrée.
+// Comme l'introselect, un budget de partitions borne le pire cas: une fois épuisé
+// (pivots répétitivement mauvais), l'intervalle restant est confié au tri Shell.
+static void quick_sort_recursive(void *data, size_t low, size_t high, size_t element_size, int (*compare_func)(const void *, const void *),
+                                 char *pivot, int depth_budget) {
+    sort_stack_enter();
+    while (low < high) {
+        if (depth_budget-- <= 0) {
+            shell_sort((char *)data + low * element_size, high - low + 1, element_size, compare_func);
+            break;
+        }
+        size_t lt, gt;
+        partition(data, low, high, element_size, compare_func, pivot, &lt, &gt);
+        if (lt - low < high - gt) {
+            if (lt > low + 1) quick_sort_recursive(data, low, lt - 1, element_size, compare_func, pivot, depth_budget);
+            low = gt + 1;
+        } else {
+            if (high > gt + 1) quick_sort_recursive(data, gt + 1, high, element_size, compare_func, pivot, depth_budget);
+            if (lt == 0) break;
+            high = lt - 1;
+        }
     }
+    sort_stack_leave();
 }
 
 static void quick_sort(void *data, size_t N, size_t element_size, int (*compare_func)(const void *, const void *)) {
     if (!data || N <= 1) return;
-    quick_sort_recursive(data, 0, N - 1, element_size, compare_func);
+    char *pivot = (char *)sort_malloc(element_size); // Copie du pivot: sa case bouge pendant la partition
+    if (!pivot) return; // Échec d'allocation
+    int depth_budget = 0;
+    for (size_t n = N; n > 1; n >>= 1) depth_budget += 2; // 2·log2(N) partitions par chaîne
+    quick_sort_recursive(data, 0, N - 1, element_size, compare_func, pivot, depth_budget);
+    sort_free(pivot);
+}
+
+
+// =========================================================================
+//                             SÉLECTION (k-ième élément / Top-k)
+// =========================================================================
+
+#define SELECT_SMALL_RANGE 16 // En dessous, un tri par insertion local est plus rapide
+
+// Échange avec un tampon fourni par l'appelant (évite un malloc par échange)
+static inline void select_swap(char *a, char *b, char *tmp, size_t element_size) {
+    if (a == b) return;
+    memcpy(tmp, a, element_size);
+    memcpy(a, b, element_size);
+    memcpy(b, tmp, element_size);
+}
+
+// Tri par insertion sur l'intervalle [low, high] (inclus)
+static void select_insertion_range(char *base, size_t low, size_t high, size_t element_size,
+                                   int (*compare_func)(const void *, const void *), char *tmp) {
+    for (size_t i = low + 1; i <= high; i++) {
+        memcpy(tmp, base + i * element_size, element_size);
+        size_t j = i;
+        while (j > low && compare_func(base + (j - 1) * element_size, tmp) > 0) {
+            memcpy(base + j * element_size, base + (j - 1) * element_size, element_size);
+            j--;
+        }
+        memcpy(base + j * element_size, tmp, element_size);
+    }
+}
+
+// Partition à trois voies (Dijkstra) autour de l'élément en position pivot_index.
+// Après l'appel: [low, *lt) < pivot, [*lt, *gt] == pivot, (*gt, high] > pivot.
+// Indispensable pour les types à faible cardinalité (Char) où Lomuto dégénère.
+static void select_partition3(char *base, size_t low, size_t high, size_t pivot_index, size_t element_size,
+                              int (*compare_func)(const void *, const void *), char *tmp, char *pivot,
+                              size_t *lt, size_t *gt) {
+    memcpy(pivot, base + pivot_index * element_size, element_size);
+    size_t l = low, i = low, g = high;
+
+    while (i <= g) {
+        int cmp = compare_func(base + i * element_size, pivot);
+        if (cmp < 0) {
+            select_swap(base + l * element_size, base + i * element_size, tmp, element_size);
+            l++;
+            i++;
+        } else if (cmp > 0) {
+            select_swap(base + i * element_size, base + g * element_size, tmp, element_size);
+            if (g == 0) break;
+            g--;
+        } else {
+            i++;
+        }
+    }
+    *lt = l;
+    *gt = g;
+}
+
+static void select_recursive(char *base, size_t low, size_t high, size_t k, size_t element_size,
+                             int (*compare_func)(const void *, const void *), char *tmp, char *pivot,
+                             int depth_budget);
+
+// Pivot par médiane des médianes (groupes de 5): garantit une réduction linéaire
+// de l'intervalle, utilisé quand le budget de l'introselect est épuisé.
+static size_t median_of_medians_pivot(char *base, size_t low, size_t high, size_t element_size,
+                                      int (*compare_func)(const void *, const void *), char *tmp, char *pivot) {
+    size_t groups = 0;
+
+    for (size_t g = low; g <= high; g += 5) {
+        size_t g_end = (g + 4 <= high) ? g + 4 : high;
+        select_insertion_range(base, g, g_end, element_size, compare_func, tmp);
+        size_t median = g + (g_end - g) / 2;
+        // Regrouper les médianes au début de l'intervalle
+        select_swap(base + (low + groups) * element_size, base + median * element_size, tmp, element_size);
+        groups++;
+        if (g_end == high) break;
+    }
+
+    size_t mid = low + (groups - 1) / 2;
+    if (groups > 1) {
+        // Budget nul: la récursion reste en mode médiane des médianes (déterministe)
+        select_recursive(base, low, low + groups - 1, mid, element_size, compare_func, tmp, pivot, 0);
+    }
+    return mid;
+}
+
+// Médiane de trois (premier, milieu, dernier) comme pivot rapide
+static size_t median_of_three_pivot(char *base, size_t low, size_t high, size_t element_size,
+                                    int (*compare_func)(const void *, const void *)) {
+    size_t mid = low + (high - low) / 2;
+    char *a = base + low * element_size;
+    char *b = base + mid * element_size;
+    char *c = base + high * element_size;
+
+    if (compare_func(a, b) < 0) {
+        if (compare_func(b, c) < 0) return mid;
+        return (compare_func(a, c) < 0) ? high : low;
+    }
+    if (compare_func(a, c) < 0) return low;
+    return (compare_func(b, c) < 0) ? high : mid;
+}
+
+// Introselect: quickselect (médiane de trois) avec repli sur la médiane des médianes
+// lorsque le nombre de partitions dépasse le budget (pire cas O(N) garanti).
+static void select_recursive(char *base, size_t low, size_t high, size_t k, size_t element_size,
+                             int (*compare_func)(const void *, const void *), char *tmp, char *pivot,
+                             int depth_budget) {
+    while (high > low) {
+        if (high - low < SELECT_SMALL_RANGE) {
+            select_insertion_range(base, low, high, element_size, compare_func, tmp);
+            return;
+        }
+
+        size_t pivot_index;
+        if (depth_budget > 0) {
+            pivot_index = median_of_three_pivot(base, low, high, element_size, compare_func);
+            depth_budget--;
+        } else {
+            pivot_index = median_of_medians_pivot(base, low, high, element_size, compare_func, tmp, pivot);
+        }
+
+        size_t lt, gt;
+        select_partition3(base, low, high, pivot_index, element_size, compare_func, tmp, pivot, &lt, &gt);
+
+        if (k < lt) {
+            high = lt - 1;
+        } else if (k > gt) {
+            low = gt + 1;
+        } else {
+            return; // k tombe dans le bloc des égaux au pivot
+        }
+    }
+}
+
+// Place le k-ième plus petit élément (k à partir de 0) à l'indice k:
+// tous les éléments avant sont <=, tous ceux après sont >=. O(N) attendu et au pire.
+static int quick_select(void *data, size_t N, size_t k, size_t element_size, int (*compare_func)(const void *, const void *)) {
+    if (!data || N == 0 || k >= N) return 0;
+
+    char *tmp = (char *)malloc(element_size * 2);
+    if (!tmp) return 0; // Échec d'allocation
+
+    // Budget de partitions "optimistes" avant bascule: 2 * log2(N)
+    int depth_budget = 0;
+    for (size_t n = N; n > 1; n >>= 1) depth_budget += 2;
+
+    select_recursive((char *)data, 0, N - 1, k, element_size, compare_func, tmp, tmp + element_size, depth_budget);
+    free(tmp);
+    return 1;
+}
+
+// Tri partiel: les k plus petits éléments sont placés, triés, dans [0, k)
+static int partial_sort_top_k(void *data, size_t N, size_t k, size_t element_size, int (*compare_func)(const void *, const void *)) {
+    if (!data || N == 0 || k == 0) return 0;
+    if (k > N) k = N;
+
+    if (k < N && !quick_select(data, N, k - 1, element_size, compare_func)) return 0;
+    qsort(data, k, element_size, compare_func);
+    return 1;
+}
+
+
+// =========================================================================
+//                             VÉRIFICATION APRÈS TRI
+// =========================================================================
+
+#define VERIFY_PARALLEL_MIN_N 65536 // En dessous, un seul thread suffit
+#define VERIFY_MAX_THREADS 16
+
+// Résultat de la vérification d'un tri
+typedef struct {
+    gboolean sorted;          // Sortie non décroissante
+    gboolean permutation_ok;  // Même multiensemble que l'entrée (empreinte)
+    size_t violations;        // Nombre de paires adjacentes mal ordonnées
+    double overhead_ms;       // Coût de la vérification (hors zone chronométrée)
+} SortVerification;
+
+// Empreinte d'un multiensemble: deux sommes de hachages mélangés (indépendantes de l'ordre)
+typedef struct {
+    guint64 sum_a;
+    guint64 sum_b;
+} MultisetHash;
+
+// Tranche de travail d'un thread de vérification
+typedef struct {
+    const char *base;
+    size_t begin;
+    size_t end;          // Exclusif
+    size_t N;
+    size_t element_size;
+    int (*compare_func)(const void *, const void *);
+    gboolean check_order;
+    size_t violations;
+    MultisetHash hash;
+} VerifyChunk;
+
+// Finaliseur splitmix64: bonne diffusion pour un coût de quelques cycles
+static inline guint64 verify_mix64(guint64 x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+// Hachage des octets de l'élément (pour les chaînes: le pointeur, qui est ce que le tri déplace)
+static inline guint64 verify_element_key(const char *elem, size_t element_size) {
+    guint64 key = 0;
+    if (element_size <= sizeof(guint64)) {
+        memcpy(&key, elem, element_size);
+        return key;
+    }
+    for (size_t i = 0; i < element_size; i += sizeof(guint64)) {
+        guint64 word = 0;
+        memcpy(&word, elem + i, (element_size - i < sizeof(guint64)) ? element_size - i : sizeof(guint64));
+        key = verify_mix64(key ^ word);
+    }
+    return key;
+}
+
+static void verify_chunk_run(VerifyChunk *chunk) {
+    const char *base = chunk->base;
+    size_t element_size = chunk->element_size;
+    size_t violations = 0;
+    guint64 sum_a = 0, sum_b = 0;
+
+    for (size_t i = chunk->begin; i < chunk->end; i++) {
+        guint64 key = verify_element_key(base + i * element_size, element_size);
+        sum_a += verify_mix64(key ^ 0x9e3779b97f4a7c15ULL);
+        sum_b += verify_mix64(key + 0x632be59bd9b4e019ULL);
+    }
+
+    if (chunk->check_order) {
+        // La tranche déborde d'un élément pour couvrir la paire à la frontière suivante
+        size_t last = (chunk->end < chunk->N) ? chunk->end : chunk->N - 1;
+
+        // Boucles sans branchement pour les types simples (vectorisables par le compilateur)
+        if (chunk->compare_func == compare_int) {
+            const int *a = (const int *)base;
+            for (size_t i = chunk->begin; i < last; i++) violations += (a[i] > a[i + 1]);
+        } else if (chunk->compare_func == compare_float) {
+            const float *a = (const float *)base;
+            for (size_t i = chunk->begin; i < last; i++) violations += (a[i] > a[i + 1]);
+        } else if (chunk->compare_func == compare_char) {
+            const char *a = base;
+            for (size_t i = chunk->begin; i < last; i++) violations += (a[i] > a[i + 1]);
+        } else {
+            for (size_t i = chunk->begin; i < last; i++) {
+                violations += (chunk->compare_func(base + i * element_size, base + (i + 1) * element_size) > 0);
+            }
+        }
+    }
+
+    chunk->violations = violations;
+    chunk->hash.sum_a = sum_a;
+    chunk->hash.sum_b = sum_b;
+}
+
+static gpointer verify_chunk_thread(gpointer user_data) {
+    verify_chunk_run((VerifyChunk *)user_data);
+    return NULL;
+}
+
+// Parcours unique (parallèle si N est grand): empreinte + nombre d'inversions adjacentes
+static void verify_scan(const void *data, size_t N, size_t element_size, int (*compare_func)(const void *, const void *),
+                        gboolean check_order, MultisetHash *hash, size_t *violations) {
+    VerifyChunk chunks[VERIFY_MAX_THREADS];
+    GThread *threads[VERIFY_MAX_THREADS];
+
+    int num_threads = 1;
+    if (N >= VERIFY_PARALLEL_MIN_N) {
+        num_threads = (int)g_get_num_processors();
+        if (num_threads > VERIFY_MAX_THREADS) num_threads = VERIFY_MAX_THREADS;
+        if (num_threads < 1) num_threads = 1;
+    }
+
+    size_t chunk_size = (N + num_threads - 1) / num_threads;
+    for (int t = 0; t < num_threads; t++) {
+        VerifyChunk *chunk = &chunks[t];
+        chunk->base = (const char *)data;
+        chunk->begin = MIN(N, (size_t)t * chunk_size);
+        chunk->end = MIN(N, chunk->begin + chunk_size);
+        chunk->N = N;
+        chunk->element_size = element_size;
+        chunk->compare_func = compare_func;
+        chunk->check_order = check_order;
+        chunk->violations = 0;
+        // Le thread appelant traite la première tranche lui-même
+        threads[t] = (t == 0) ? NULL : g_thread_new("verify", verify_chunk_thread, chunk);
+    }
+    verify_chunk_run(&chunks[0]);
+
+    hash->sum_a = 0;
+    hash->sum_b = 0;
+    *violations = 0;
+    for (int t = 0; t < num_threads; t++) {
+        if (threads[t]) g_thread_join(threads[t]);
+        hash->sum_a += chunks[t].hash.sum_a;
+        hash->sum_b += chunks[t].hash.sum_b;
+        *violations += chunks[t].violations;
+    }
+}
+
+// Tri chronométré suivi de la vérification (ordre + permutation).
+// L'empreinte de l'entrée et la vérification sont mesurées à part et exclues du temps retourné.
+// Les mesures mémoire (allocations auxiliaires, pile, pic RSS) sont relevées pendant le tri lui-même.
+static double run_verified_sort(SortFunction sort_func, void *data, size_t N, size_t element_size,
+                                int (*compare_func)(const void *, const void *), SortVerification *verification,
+                                SortMemoryStats *memory) {
+    MultisetHash before, after;
+    size_t unused = 0;
+    char stack_marker;
+
+    gint64 start = g_get_monotonic_time();
+    verify_scan(data, N, element_size, compare_func, FALSE, &before, &unused);
+    gint64 overhead = g_get_monotonic_time() - start;
+
+    long rss_before_kb = process_peak_rss_kb();
+    sort_memory_begin(&stack_marker);
+    double time_ms = measure_time(sort_func, data, N, element_size, compare_func);
+    sort_memory_end(memory, rss_before_kb);
+
+    start = g_get_monotonic_time();
+    size_t violations = 0;
+    verify_scan(data, N, element_size, compare_func, TRUE, &after, &violations);
+    overhead += g_get_monotonic_time() - start;
+
+    if (verification) {
+        verification->violations = violations;
+        verification->sorted = (violations == 0);
+        verification->permutation_ok = (before.sum_a == after.sum_a && before.sum_b == after.sum_b);
+        verification->overhead_ms = overhead / 1000.0;
+    }
+    return time_ms;
+}
+
+// --- Garde-fou pour les noyaux en O(N²) (bulles, insertion) ---
+// Les tris s'exécutent sur le thread de l'interface: avant de lancer un noyau quadratique,
+// on le chronomètre sur un échantillon et on extrapole en N². Au-delà du budget par
+// méthode (celui des courbes), le tri n'est pas lancé.
+#define SORT_PROBE_N 2000
+
+static gboolean sort_is_quadratic(SortFunction sort_func) {
+    return sort_func == bubble_sort || sort_func == insertion_sort;
+}
+
+static double sort_budget_seconds(AppData *app_data) {
+    return app_data->curve_budget_input ? gtk_spin_button_get_value(app_data->curve_budget_input) : 5.0;
+}
+
+// Temps prévu (s) pour trier N éléments; 0 pour un noyau non quadratique ou un petit N
+static double sort_predict_quadratic_s(SortFunction sort_func, const void *data, size_t N, size_t element_size,
+                                       int (*compare_func)(const void *, const void *)) {
+    if (!sort_is_quadratic(sort_func) || N <= SORT_PROBE_N) return 0.0;
+    void *sample = malloc(SORT_PROBE_N * element_size);
+    if (!sample) return 0.0; // Échec d'allocation
+    memcpy(sample, data, SORT_PROBE_N * element_size);
+    double probe_ms = measure_time(sort_func, sample, SORT_PROBE_N, element_size, compare_func);
+    free(sample);
+    double ratio = (double)N / SORT_PROBE_N;
+    return probe_ms / 1000.0 * ratio * ratio;
+}
+
+// Résumé textuel d'une vérification (pour les dialogues et vues de résultats)
+static const gchar *verification_label(const SortVerification *verification) {
+    if (verification->sorted && verification->permutation_ok) return "✔ trié, permutation valide";
+    if (!verification->sorted && !verification->permutation_ok) return "✘ NON TRIÉ et éléments altérés";
+    if (!verification->sorted) return "✘ NON TRIÉ";
+    return "✘ éléments altérés (pas une permutation)";
+}
+
+// =========================================================================
+//                             TRI INDIRECT (ARGSORT)
+// =========================================================================
+// Les noyaux de tri trient un tableau d'indices 32 bits (N <= MAX_N) au lieu de déplacer
+// les éléments. Option: chaque indice est accompagné d'un préfixe de clé de 64 bits
+// (ordre préservé) qui évite la plupart des accès au tableau d'origine lors des comparaisons.
+
+// Enregistrement trié en mode "préfixes de clés"
+typedef struct {
+    guint64 prefix;
+    guint32 index;
+} ArgsortEntry;
+
+// Contexte de comparaison (les noyaux n'acceptent pas de paramètre utilisateur)
+typedef struct {
+    const char *base;
+    size_t element_size;
+    int (*compare_func)(const void *, const void *);
+    gboolean prefix_exact;       // Préfixe égal => clés égales (Int, Float, Char)
+    SortFunction kernel;         // Noyau utilisé par argsort_sort_in_place
+    gboolean use_prefix;
+} ArgsortContext;
+
+static ArgsortContext argsort_ctx = {0};
+
+static int compare_argsort_index(const void *a, const void *b) {
+    guint32 ia = *(const guint32 *)a;
+    guint32 ib = *(const guint32 *)b;
+    return argsort_ctx.compare_func(argsort_ctx.base + (size_t)ia * argsort_ctx.element_size,
+                                    argsort_ctx.base + (size_t)ib * argsort_ctx.element_size);
+}
+
+static int compare_argsort_entry(const void *a, const void *b) {
+    const ArgsortEntry *ea = (const ArgsortEntry *)a;
+    const ArgsortEntry *eb = (const ArgsortEntry *)b;
+    if (ea->prefix < eb->prefix) return -1;
+    if (ea->prefix > eb->prefix) return 1;
+    if (argsort_ctx.prefix_exact) return 0;
+    return argsort_ctx.compare_func(argsort_ctx.base + (size_t)ea->index * argsort_ctx.element_size,
+                                    argsort_ctx.base + (size_t)eb->index * argsort_ctx.element_size);
+}
+
+// Préfixe de 64 bits dont l'ordre non signé respecte la fonction de comparaison du type
+static guint64 argsort_key_prefix(const char *elem, int (*compare_func)(const void *, const void *)) {
+    if (compare_func == compare_int) {
+        return (guint64)((gint64)*(const int *)elem - (gint64)G_MININT);
+    }
+    if (compare_func == compare_float) {
+        guint32 bits;
+        memcpy(&bits, elem, sizeof(bits));
+        // Ordre total IEEE-754: négatifs inversés, positifs décalés au-dessus
+        return (bits & 0x80000000u) ? (guint64)(~bits) : (guint64)(bits | 0x80000000u);
+    }
+    if (compare_func == compare_char) {
+        return (guint64)((int)*(const char *)elem - CHAR_MIN);
+    }
+    if (compare_func == compare_string) {
+        // 8 premiers octets en gros-boutiste (strcmp compare en unsigned char)
+        const unsigned char *str = *(const unsigned char **)elem;
+        guint64 prefix = 0;
+        int i = 0;
+        for (; i < 8 && str && str[i]; i++) prefix = (prefix << 8) | str[i];
+        return i ? prefix << (8 * (8 - i)) : 0; // Décaler de 64 bits serait indéfini
+    }
+    return 0;
+}
+
+// Trie les indices de data sans modifier data: indices[r] = position de l'élément de rang r
+static gboolean argsort(const void *data, size_t N, size_t element_size, int (*compare_func)(const void *, const void *),
+                        SortFunction kernel, gboolean use_prefix, guint32 *indices) {
+    if (!data || !indices || N > G_MAXUINT32) return FALSE;
+
+    argsort_ctx.base = (const char *)data;
+    argsort_ctx.element_size = element_size;
+    argsort_ctx.compare_func = compare_func;
+    argsort_ctx.prefix_exact = (compare_func == compare_int || compare_func == compare_float || compare_func == compare_char);
+
+    if (!use_prefix) {
+        for (size_t i = 0; i < N; i++) indices[i] = (guint32)i;
+        kernel(indices, N, sizeof(guint32), compare_argsort_index);
+        return TRUE;
+    }
+
+    ArgsortEntry *entries = (ArgsortEntry *)sort_malloc(N * sizeof(ArgsortEntry));
+    if (!entries) return FALSE;
+
+    const char *base = (const char *)data;
+    for (size_t i = 0; i < N; i++) {
+        entries[i].prefix = argsort_key_prefix(base + i * element_size, compare_func);
+        entries[i].index = (guint32)i;
+    }
+    kernel(entries, N, sizeof(ArgsortEntry), compare_argsort_entry);
+    for (size_t i = 0; i < N; i++) indices[i] = entries[i].index;
+
+    sort_free(entries);
+    return TRUE;
+}
+
+// Applique la permutation en une passe: lecture dispersée, écriture séquentielle, puis recopie
+static gboolean apply_permutation(void *data, size_t N, size_t element_size, const guint32 *indices) {
+    char *buffer = (char *)sort_malloc(N * element_size);
+    if (!buffer) return FALSE;
+
+    const char *base = (const char *)data;
+    for (size_t i = 0; i < N; i++) {
+        memcpy(buffer + i * element_size, base + (size_t)indices[i] * element_size, element_size);
+    }
+    memcpy(data, buffer, N * element_size);
+    sort_free(buffer);
+    return TRUE;
+}
+
+// Adaptateur de signature SortFunction: argsort avec le noyau du contexte puis permutation.
+// Permet de chronométrer et vérifier le mode indirect comme n'importe quel tri direct.
+static void argsort_sort_in_place(void *data, size_t N, size_t element_size, int (*compare_func)(const void *, const void *)) {
+    if (!data || N <= 1) return;
+
+    SortFunction kernel = argsort_ctx.kernel ? argsort_ctx.kernel : quick_sort;
+    gboolean use_prefix = argsort_ctx.use_prefix;
+
+    guint32 *indices = (guint32 *)sort_malloc(N * sizeof(guint32));
+    if (!indices) return;
+
+    if (argsort(data, N, element_size, compare_func, kernel, use_prefix, indices)) {
+        apply_permutation(data, N, element_size, indices);
+    }
+    sort_free(indices);
 }
 
 static void create_curve_window(GtkWidget *parent_window, AppData *app_data);
@@ -609,6 +1480,7 @@ static gboolean on_array_window_delete(GtkWidget *widget, GdkEvent *event, gpoin
 static void on_array_window_destroy(GtkWidget *widget, gpointer user_data);
 static void on_list_window_destroy(GtkWidget *widget, gpointer user_data);
 static void on_graph_window_destroy(GtkWidget *widget, gpointer user_data);
+static void on_tree_window_destroy(GtkWidget *widget, gpointer user_data);
 
 // --- BFS (Largeur) ---
 static void bfs_binary(BinaryNode *root, GString *str, const gchar *type) {
@@ -666,25 +1538,41 @@ static void bfs_binary(BinaryNode *root, GString *str, const gchar *type) {
 // where left = first_child and right = next_sibling.
 
 static BinaryNode *convert_nary_to_binary(NaryNode *nary_node, size_t element_size) {
-    if (!nary_node) return NULL;
-
-    BinaryNode *bin_node = g_new0(BinaryNode, 1);
-    if (!bin_node) return NULL; // Échec d'allocation
+    BinaryNode *result = NULL;
 
-    bin_node->data = malloc(element_size);
-    if (!bin_node->data) {
-        g_free(bin_node); // Libérer le nœud si l'allocation de données échoue
-        return NULL;
+    // La pile contient des paires (nœud N-aire source, lien binaire à remplir)
+    TreeStack stack = {0};
+    if (nary_node) {
+        tree_stack_push(&stack, &result);
+        tree_stack_push(&stack, nary_node);
     }
-    memcpy(bin_node->data, nary_node->data, element_size);
+    while (stack.count) {
+        NaryNode *src = tree_stack_pop(&stack);
+        BinaryNode **link = tree_stack_pop(&stack);
 
-    // Left child in Binary becomes First Child of N-Ary
-    bin_node->left = convert_nary_to_binary(nary_node->first_child, element_size);
+        BinaryNode *bin_node = g_new0(BinaryNode, 1);
+        bin_node->data = malloc(element_size);
+        if (!bin_node->data) {
+            g_free(bin_node); // Échec d'allocation: sous-arbre abandonné
+            continue;
+        }
+        memcpy(bin_node->data, src->data, element_size);
+        *link = bin_node;
 
-    // Right child in Binary becomes Next Sibling of N-Ary
-    bin_node->right = convert_nary_to_binary(nary_node->next_sibling, element_size);
+        // Right child in Binary becomes Next Sibling of N-Ary
+        if (src->next_sibling) {
+            tree_stack_push(&stack, &bin_node->right);
+            tree_stack_push(&stack, src->next_sibling);
+        }
+        // Left child in Binary becomes First Child of N-Ary
+        if (src->first_child) {
+            tree_stack_push(&stack, &bin_node->left);
+            tree_stack_push(&stack, src->first_child);
+        }
+    }
+    tree_stack_free(&stack);
 
-    return bin_node;
+    return result;
 }
 
 // =========================================================================
@@ -769,19 +1657,45 @@ static void on_single_sort_clicked(GtkWidget *widget, gpointer data) {
     else if (g_strcmp0(method_name, "Tri Shell") == 0) sort_func = shell_sort;
     else if (g_strcmp0(method_name, "Tri Quicksort") == 0) sort_func = quick_sort;
 
-    // 3. Mesurer le temps (et simuler le tri) (Retourne MS)
-    double time_ms = measure_time(sort_func, data_copy, app_data->current_N, app_data->element_size, compare_func);
-    double time_sec = time_ms / 1000.0;
+    // Un noyau quadratique sur un grand N bloquerait l'interface: refuser au-delà du budget
+    double budget_s = sort_budget_seconds(app_data);
+    double predicted_s = sort_predict_quadratic_s(sort_func, data_copy, app_data->current_N, app_data->element_size, compare_func);
+    if (predicted_s > budget_s) {
+        free(data_copy);
+        show_error_dialog(app_data->parent_window, "Tri trop long",
+            g_strdup_printf("%s sur N=%lu: environ %.0f s prévues (O(N²)), au-delà du budget de %.1f s par méthode.\n"
+                            "Réduisez N ou augmentez le budget.", method_name, app_data->current_N, predicted_s, budget_s));
+        return;
+    }
 
-    // Après le tri simulé, nous trions réellement la copie pour l'affichage
-    qsort(data_copy, app_data->current_N, app_data->element_size, compare_func);
+    // Mode indirect: le noyau choisi trie les indices, la permutation est appliquée ensuite
+    gboolean indirect = gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(app_data->argsort_toggle));
+    if (indirect) {
+        argsort_ctx.kernel = sort_func;
+        argsort_ctx.use_prefix = gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(app_data->argsort_prefix_toggle));
+        sort_func = argsort_sort_in_place;
+    }
+
+    // 3. Trier la copie en mesurant le temps, puis vérifier le résultat (Retourne MS)
+    SortVerification verification;
+    SortMemoryStats memory;
+    double time_ms = run_verified_sort(sort_func, data_copy, app_data->current_N, app_data->element_size, compare_func, &verification, &memory);
+    double time_sec = time_ms / 1000.0;
 
 
     // 4. Afficher les résultats
     GString *output = g_string_new("");
     g_string_append_printf(output, "--- Résultats du Tri Simple (%s) ---\n\n", method_name);
     g_string_append_printf(output, "Taille N: %lu\n", app_data->current_N);
-    g_string_append_printf(output, "Temps d'exécution: %.6f s\n\n", time_sec); // Affichage en SECONDES
+    if (indirect) {
+        g_string_append_printf(output, "Mode: indirect (argsort%s)\n", argsort_ctx.use_prefix ? " + préfixes de clés" : "");
+    }
+    g_string_append_printf(output, "Temps d'exécution: %.6f s\n", time_sec); // Affichage en SECONDES
+    g_string_append_printf(output, "Vérification: %s (%.3f ms, hors chronométrage)\n",
+                           verification_label(&verification), verification.overhead_ms);
+    g_string_append(output, "Mémoire: ");
+    append_memory_summary(output, &memory);
+    g_string_append(output, "\n\n");
 
     // Afficher le tableau non trié (original)
     const gchar *source_label = (app_data->input_source == 1) ? "Tableau Non Trié (Manuel)" : "Tableau Non Trié (Aléatoire)";
@@ -844,26 +1758,41 @@ static void on_comparison_execute_current_n_clicked(GtkWidget *widget, gpointer
 
     size_t total_size = app_data->current_N * app_data->element_size;
     double times[4];
+    double predicted[4];
+    SortVerification verifications[4];
+    SortMemoryStats memory[4];
+    double verification_overhead_ms = 0.0;
+    double budget_s = sort_budget_seconds(app_data);
 
-    // Mesurer les temps pour chaque méthode
+    // Mesurer les temps pour chaque méthode (la vérification est exclue du temps mesuré)
     for (int i = 0; i < num_methods; i++) {
+        // Noyau quadratique trop long pour ce N: non exécuté
+        predicted[i] = sort_predict_quadratic_s(sort_funcs[i], original_data, app_data->current_N, app_data->element_size, compare_func);
+        if (predicted[i] > budget_s) continue;
+
         void *data_copy = malloc(total_size);
         memcpy(data_copy, original_data, total_size);
 
-        double time_ms = measure_time(sort_funcs[i], data_copy, app_data->current_N, app_data->element_size, compare_func);
+        double time_ms = run_verified_sort(sort_funcs[i], data_copy, app_data->current_N, app_data->element_size, compare_func, &verifications[i], &memory[i]);
         times[i] = time_ms / 1000.0; // Convertir en secondes
+        verification_overhead_ms += verifications[i].overhead_ms;
 
         free(data_copy);
     }
 
-    // Les temps sont maintenant correctement ordonnés grâce à measure_time corrigée
-    // Ordre attendu: Bubble (0) > Insertion (1) > Shell (2) > Quick (3)
-
-    // Créer le résumé avec les temps corrigés
+    // Créer le résumé avec les temps et le résultat de la vérification
     GString *time_summary = g_string_new("--- Résumé de la Comparaison (N Actuel) ---\n\n");
     for (int i = 0; i < num_methods; i++) {
-        g_string_append_printf(time_summary, "%s: %.6f s\n", METHOD_NAMES[i], times[i]);
+        if (predicted[i] > budget_s) {
+            g_string_append_printf(time_summary, "%s: non exécuté (≈ %.0f s prévues, budget %.1f s)\n",
+                                   METHOD_NAMES[i], predicted[i], budget_s);
+            continue;
+        }
+        g_string_append_printf(time_summary, "%s: %.6f s  [%s]\n    ", METHOD_NAMES[i], times[i], verification_label(&verifications[i]));
+        append_memory_summary(time_summary, &memory[i]);
+        g_string_append(time_summary, "\n");
     }
+    g_string_append_printf(time_summary, "\nCoût total des vérifications (non inclus): %.3f ms\n", verification_overhead_ms);
 
     GtkWidget *dialog = gtk_message_dialog_new(
         GTK_WINDOW(gtk_widget_get_toplevel(widget)),
@@ -886,6 +1815,61 @@ static void on_comparison_execute_current_n_clicked(GtkWidget *widget, gpointer
     gtk_text_buffer_set_text(buffer, "Comparaison terminée. Voir la boîte de dialogue pour les temps. Le tableau non trié est affiché à gauche.", -1);
 }
 
+// --- Ajustement des courbes à des modèles de complexité ---
+
+#define FIT_MODEL_COUNT 4
+static const gchar *FIT_MODEL_NAMES[FIT_MODEL_COUNT] = {"n", "n log n", "n^1.3", "n²"};
+// Modèle théorique de chaque méthode (utilisé quand un seul point a pu être mesuré)
+static const int METHOD_DEFAULT_MODEL[4] = {3, 3, 2, 1};
+
+static double fit_model_value(int model, double n) {
+    switch (model) {
+        case 0: return n;
+        case 1: return (n > 1.0) ? n * log2(n) : n;
+        case 2: return pow(n, 1.3);
+        default: return n * n;
+    }
+}
+
+// Moindres carrés t ≈ c·f(n) pour chaque modèle; le modèle retenu minimise l'erreur relative
+// (sinon le plus grand N écraserait les autres points). Retourne l'indice du modèle.
+static int fit_complexity_model(const double *n, const double *t, int count, int default_model, double *constant) {
+    int best_model = default_model;
+    double best_error = G_MAXDOUBLE;
+    double best_constant = 0.0;
+
+    for (int m = 0; m < FIT_MODEL_COUNT; m++) {
+        double sum_tf = 0.0, sum_ff = 0.0;
+        for (int i = 0; i < count; i++) {
+            double f = fit_model_value(m, n[i]);
+            sum_tf += t[i] * f;
+            sum_ff += f * f;
+        }
+        if (sum_ff <= 0.0) continue;
+        double c = sum_tf / sum_ff;
+
+        double error = 0.0;
+        for (int i = 0; i < count; i++) {
+            double r = (t[i] - c * fit_model_value(m, n[i])) / (t[i] > 0.0 ? t[i] : 1.0);
+            error += r * r;
+        }
+
+        if (count < 2) {
+            // Un seul point: tous les modèles passent exactement, on garde le modèle théorique
+            if (m == default_model) best_constant = c;
+            continue;
+        }
+        if (error < best_error) {
+            best_error = error;
+            best_model = m;
+            best_constant = c;
+        }
+    }
+
+    *constant = best_constant;
+    return best_model;
+}
+
 static void on_comparison_calculate_for_curve_clicked(GtkWidget *widget, gpointer data) {
     AppData *app_data = (AppData *)data;
 
@@ -917,11 +1901,21 @@ static void on_comparison_calculate_for_curve_clicked(GtkWidget *widget, gpointe
     int (*compare_func)(const void *, const void *);
     get_type_info(type, &element_size, &compare_func);
 
+    // Budget de temps par méthode (secondes): au-delà, N n'augmente plus pour cette méthode
+    double budget_s = gtk_spin_button_get_value(app_data->curve_budget_input);
+    double spent_s[4] = {0.0, 0.0, 0.0, 0.0};
+    double probe_s[4] = {0.0, 0.0, 0.0, 0.0}; // Prévision au premier N quand il dépasse déjà le budget
+
     GtkTextBuffer *buffer = gtk_text_view_get_buffer(app_data->sorted_view);
     gtk_text_buffer_set_text(buffer, "Calcul des courbes en cours (Seconde)...", -1);
 
     while (gtk_events_pending()) gtk_main_iteration();
 
+    int failed_checks = 0;
+    double verification_overhead_ms = 0.0;
+    memset(app_data->comparison_measured, 0, sizeof(app_data->comparison_measured));
+    memcpy(app_data->comparison_N, N_values, sizeof(N_values));
+
     for (int j = 0; j < 5; j++) {
         int N = N_values[j];
         void *original_data = generate_random_data(N, type, &element_size, &compare_func);
@@ -929,27 +1923,379 @@ static void on_comparison_calculate_for_curve_clicked(GtkWidget *widget, gpointe
 
         // Measure all
         for (int i = 0; i < num_methods; i++) {
+            // Prévision prudente (croissance quadratique) à partir du dernier point mesuré
+            if (j > 0) {
+                if (!app_data->comparison_measured[i][j - 1]) continue;
+                double ratio = (double)N / (double)N_values[j - 1];
+                double predicted_s = app_data->comparison_times[i][j - 1] * ratio * ratio;
+                if (spent_s[i] >= budget_s || spent_s[i] + predicted_s > budget_s) continue;
+            } else {
+                // Premier point: prévision sur échantillon pour les noyaux quadratiques
+                double predicted_s = sort_predict_quadratic_s(sort_funcs[i], original_data, N, element_size, compare_func);
+                if (predicted_s > budget_s) {
+                    probe_s[i] = predicted_s;
+                    continue;
+                }
+            }
+
             void *data_copy = malloc(total_size);
             memcpy(data_copy, original_data, total_size);
 
-            double time_ms = measure_time(sort_funcs[i], data_copy, N, element_size, compare_func);
+            SortVerification verification;
+            SortMemoryStats memory;
+            double time_ms = run_verified_sort(sort_funcs[i], data_copy, N, element_size, compare_func, &verification, &memory);
             app_data->comparison_times[i][j] = time_ms / 1000.0; // Seconds
+            app_data->comparison_memory[i][j] = memory;
+            app_data->comparison_measured[i][j] = TRUE;
+            spent_s[i] += time_ms / 1000.0;
+            verification_overhead_ms += verification.overhead_ms;
+            if (!verification.sorted || !verification.permutation_ok) failed_checks++;
 
             free(data_copy);
         }
 
-        // Les temps sont maintenant correctement ordonnés grâce à measure_time corrigée
-        // Ordre attendu: Bubble (0) > Insertion (1) > Shell (2) > Quick (3)
-
         free_data(original_data, N, type);
     }
 
-    gtk_text_buffer_set_text(buffer, "Calcul terminé.", -1);
+    // Ajustement des modèles et extrapolation jusqu'au plus grand N
+    GString *report = g_string_new("");
+    if (failed_checks == 0) {
+        g_string_append_printf(report, "Calcul terminé. Vérification: tous les tris sont corrects (%.3f ms, hors chronométrage).\n", verification_overhead_ms);
+    } else {
+        g_string_append_printf(report, "Calcul terminé. ✘ Vérification: %d tri(s) incorrect(s) !\n", failed_checks);
+    }
+    g_string_append_printf(report, "\n--- Modèles ajustés (budget %.1f s par méthode) ---\n", budget_s);
+
+    for (int i = 0; i < num_methods; i++) {
+        double n_points[5], t_points[5];
+        int count = 0;
+        for (int j = 0; j < 5; j++) {
+            if (!app_data->comparison_measured[i][j]) continue;
+            n_points[count] = N_values[j];
+            t_points[count] = app_data->comparison_times[i][j];
+            count++;
+        }
+
+        if (count == 0) {
+            // Aucun point mesuré: la constante vient de la prévision sur échantillon
+            n_points[0] = N_values[0];
+            t_points[0] = probe_s[i];
+            app_data->fit_model[i] = fit_complexity_model(n_points, t_points, 1, METHOD_DEFAULT_MODEL[i], &app_data->fit_constant[i]);
+        } else {
+            app_data->fit_model[i] = fit_complexity_model(n_points, t_points, count, METHOD_DEFAULT_MODEL[i], &app_data->fit_constant[i]);
+        }
+
+        for (int j = 0; j < 5; j++) {
+            if (!app_data->comparison_measured[i][j]) {
+                app_data->comparison_times[i][j] = app_data->fit_constant[i] * fit_model_value(app_data->fit_model[i], N_values[j]);
+                memset(&app_data->comparison_memory[i][j], 0, sizeof(SortMemoryStats));
+            }
+        }
+
+        g_string_append_printf(report, "%s: t ≈ %.3e × %s s  (%d/5 points mesurés, %.2f s)",
+                               METHOD_NAMES[i], app_data->fit_constant[i], FIT_MODEL_NAMES[app_data->fit_model[i]], count, spent_s[i]);
+        if (count < 5) {
+            g_string_append_printf(report, "  → extrapolé à N=%d: %.2f s", N_values[4], app_data->comparison_times[i][4]);
+        }
+        g_string_append(report, "\n");
+    }
+
+    gtk_text_buffer_set_text(buffer, report->str, -1);
+    g_string_free(report, TRUE);
 
+    app_data->curves_computed = TRUE;
     app_data->is_single_sort_mode = 0;
     app_data->N_initial = start_N;
 }
 
+// --- Formatage d'un élément unique selon son type ---
+static void append_element_value(GString *output, const void *elem, const gchar *type) {
+    if (g_strcmp0(type, "Entiers (Int)") == 0) {
+        g_string_append_printf(output, "%d", *(const int *)elem);
+    } else if (g_strcmp0(type, "Réels (Float)") == 0) {
+        g_string_append_printf(output, "%.2f", *(const float *)elem);
+    } else if (g_strcmp0(type, "Caractères (Char)") == 0) {
+        g_string_append_printf(output, "'%c'", *(const char *)elem);
+    } else if (g_strcmp0(type, "Chaîne de Caractères") == 0) {
+        const char *value = *(const char **)elem;
+        g_string_append_printf(output, "\"%s\"", value ? value : "NULL");
+    } else {
+        g_string_append(output, "?");
+    }
+}
+
+// --- Préparation des données d'entrée (aléatoires ou manuelles) ---
+// Retourne le tableau courant (conservé dans app_data) ou NULL après affichage de l'erreur.
+static void *prepare_array_input(AppData *app_data, int (**compare_func)(const void *, const void *)) {
+    const gchar *type = gtk_combo_box_text_get_active_text(GTK_COMBO_BOX_TEXT(app_data->type_combo));
+    if (!type) type = "Entiers (Int)";
+
+    if (app_data->initial_data_ptr) {
+        free_data(app_data->initial_data_ptr, app_data->current_N, app_data->current_type);
+        app_data->initial_data_ptr = NULL;
+    }
+    app_data->current_type = type;
+
+    if (app_data->input_source == 1) {
+        size_t actual_N = 0;
+        app_data->initial_data_ptr = parse_manual_data(app_data->manual_input_view, type, &app_data->element_size, compare_func, &actual_N);
+
+        if (!app_data->initial_data_ptr || actual_N == 0) {
+            show_error_dialog(app_data->parent_window, "Erreur de saisie",
+                "Veuillez saisir des valeurs dans le champ de texte manuel. Les valeurs doivent être séparées par des espaces, virgules ou retours à la ligne.");
+            return NULL;
+        }
+        app_data->current_N = actual_N;
+
+        if (app_data->current_N > MAX_N) {
+            free_data(app_data->initial_data_ptr, app_data->current_N, type);
+            app_data->initial_data_ptr = NULL;
+            show_error_dialog(app_data->parent_window, "Erreur de taille",
+                g_strdup_printf("La taille maximale est %d éléments. Veuillez réduire le nombre de valeurs.", MAX_N));
+            return NULL;
+        }
+    } else {
+        int N = gtk_spin_button_get_value_as_int(app_data->size_input);
+        if (N <= 0 || N > MAX_N) {
+            show_error_dialog(app_data->parent_window, "Erreur de taille",
+                g_strdup_printf("La taille doit être comprise entre 1 et %d éléments.", MAX_N));
+            return NULL;
+        }
+        app_data->current_N = N;
+
+        app_data->initial_data_ptr = generate_random_data(N, type, &app_data->element_size, compare_func);
+        if (!app_data->initial_data_ptr) {
+            show_error_dialog(app_data->parent_window, "Erreur mémoire",
+                "Échec d'allocation mémoire. Réduisez la taille ou fermez d'autres applications.");
+            return NULL;
+        }
+    }
+
+    return app_data->initial_data_ptr;
+}
+
+// --- Statistiques d'ordre et Top-k par sélection (sans tri complet) ---
+static void on_selection_clicked(GtkWidget *widget, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    int (*compare_func)(const void *, const void *);
+
+    void *original_data = prepare_array_input(app_data, &compare_func);
+    if (!original_data) return;
+
+    size_t N = app_data->current_N;
+    size_t element_size = app_data->element_size;
+    size_t total_size = N * element_size;
+
+    size_t k = (size_t)gtk_spin_button_get_value_as_int(app_data->selection_k_input);
+    if (k == 0) k = 1;
+    if (k > N) k = N;
+
+    void *work = malloc(total_size);
+    void *top_k = malloc(total_size);
+    void *full = malloc(total_size);
+    if (!work || !top_k || !full) {
+        free(work);
+        free(top_k);
+        free(full);
+        show_error_dialog(app_data->parent_window, "Erreur mémoire", "Échec d'allocation mémoire pour la sélection.");
+        return;
+    }
+
+    // Statistiques d'ordre: min, quartiles, percentiles, max
+    static const struct { const gchar *label; double q; } quantiles[] = {
+        {"Minimum", 0.0}, {"Q1 (25%)", 0.25}, {"Médiane", 0.5}, {"Q3 (75%)", 0.75},
+        {"P90", 0.90}, {"P99", 0.99}, {"Maximum", 1.0}
+    };
+    int num_quantiles = sizeof(quantiles) / sizeof(quantiles[0]);
+
+    GString *stats = g_string_new("");
+    memcpy(work, original_data, total_size);
+
+    gint64 t_select = 0;
+    for (int i = 0; i < num_quantiles; i++) {
+        size_t rank = (size_t)(quantiles[i].q * (double)(N - 1) + 0.5);
+
+        gint64 t0 = g_get_monotonic_time();
+        quick_select(work, N, rank, element_size, compare_func);
+        t_select += g_get_monotonic_time() - t0;
+
+        g_string_append_printf(stats, "  %-10s (rang %lu): ", quantiles[i].label, (unsigned long)rank);
+        append_element_value(stats, (char *)work + rank * element_size, app_data->current_type);
+        g_string_append(stats, "\n");
+    }
+
+    // Top-k: les k plus petits, triés
+    memcpy(top_k, original_data, total_size);
+    gint64 t0 = g_get_monotonic_time();
+    partial_sort_top_k(top_k, N, k, element_size, compare_func);
+    gint64 t_top_k = g_get_monotonic_time() - t0;
+
+    // Référence: tri complet
+    memcpy(full, original_data, total_size);
+    t0 = g_get_monotonic_time();
+    qsort(full, N, element_size, compare_func);
+    gint64 t_full = g_get_monotonic_time() - t0;
+
+    GString *output = g_string_new("");
+    g_string_append_printf(output, "--- Sélection / Top-k (Introselect) ---\n\n");
+    g_string_append_printf(output, "Taille N: %lu   k: %lu\n\n", (unsigned long)N, (unsigned long)k);
+    g_string_append(output, "Statistiques d'ordre:\n");
+    g_string_append(output, stats->str);
+    g_string_append_printf(output, "\nTemps de sélection (%d statistiques): %.6f s\n", num_quantiles, t_select / 1e6);
+    g_string_append_printf(output, "Temps du Top-%lu (tri partiel): %.6f s\n", (unsigned long)k, t_top_k / 1e6);
+    g_string_append_printf(output, "Temps du tri complet (qsort): %.6f s\n", t_full / 1e6);
+    if (t_top_k > 0) {
+        g_string_append_printf(output, "Gain du Top-k sur le tri complet: x%.2f\n", (double)t_full / (double)t_top_k);
+    }
+
+    // Les k premiers du tableau partiellement trié sont affichés (limités pour la lisibilité)
+    size_t shown = (k > 1000) ? 1000 : k;
+    g_string_append_printf(output, "\nTop-%lu (%lu affichés):\n", (unsigned long)k, (unsigned long)shown);
+    for (size_t i = 0; i < shown; i++) {
+        append_element_value(output, (char *)top_k + i * element_size, app_data->current_type);
+        if (i < shown - 1) g_string_append(output, ((i + 1) % 10 == 0) ? "\n" : ", ");
+    }
+
+    const gchar *source_label = (app_data->input_source == 1) ? "Tableau Non Trié (Manuel)" : "Tableau Non Trié (Aléatoire)";
+    display_array_in_view(GTK_WIDGET(app_data->unsorted_view), original_data, N, element_size, app_data->current_type, source_label);
+
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(app_data->sorted_view);
+    gtk_text_buffer_set_text(buffer, output->str, -1);
+
+    g_string_free(stats, TRUE);
+    g_string_free(output, TRUE);
+    // Copies superficielles: les chaînes appartiennent au tableau original
+    free(work);
+    free(top_k);
+    free(full);
+}
+
+// --- Benchmark: tri direct vs tri indirect (argsort) pour les 4 méthodes ---
+static void on_argsort_benchmark_clicked(GtkWidget *widget, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    int (*compare_func)(const void *, const void *);
+
+    void *original_data = prepare_array_input(app_data, &compare_func);
+    if (!original_data) return;
+
+    size_t N = app_data->current_N;
+    size_t element_size = app_data->element_size;
+    size_t total_size = N * element_size;
+
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(app_data->sorted_view);
+    gtk_text_buffer_set_text(buffer, "Benchmark argsort en cours...", -1);
+    while (gtk_events_pending()) gtk_main_iteration();
+
+    void *work = malloc(total_size);
+    guint32 *indices = (guint32 *)malloc(N * sizeof(guint32));
+    if (!work || !indices) {
+        free(work);
+        free(indices);
+        show_error_dialog(app_data->parent_window, "Erreur mémoire", "Échec d'allocation mémoire pour le benchmark.");
+        return;
+    }
+
+    SortFunction sort_funcs[] = {bubble_sort, insertion_sort, shell_sort, quick_sort};
+    GString *output = g_string_new("");
+    g_string_append_printf(output, "--- Tri Direct vs Tri Indirect (Argsort) ---\n\nTaille N: %lu   Type: %s   (élément: %lu o)\n\n",
+                           (unsigned long)N, app_data->current_type, (unsigned long)element_size);
+    g_string_append(output, "Méthode              Direct      Indices     Ind.+préf.  Permutation  Total ind.\n");
+
+    double budget_s = sort_budget_seconds(app_data);
+    for (int i = 0; i < 4; i++) {
+        // Le noyau tourne trois fois (direct, indices, indices + préfixes): même budget par méthode
+        double predicted_s = 3.0 * sort_predict_quadratic_s(sort_funcs[i], original_data, N, element_size, compare_func);
+        if (predicted_s > budget_s) {
+            g_string_append_printf(output, "%-20s non exécuté (≈ %.0f s prévues, budget %.1f s)\n",
+                                   METHOD_NAMES[i], predicted_s, budget_s);
+            continue;
+        }
+
+        // Tri direct (déplace les éléments)
+        memcpy(work, original_data, total_size);
+        double direct_ms = measure_time(sort_funcs[i], work, N, element_size, compare_func);
+
+        // Indices seuls: le tableau d'origine reste intact
+        gint64 t0 = g_get_monotonic_time();
+        argsort(original_data, N, element_size, compare_func, sort_funcs[i], FALSE, indices);
+        double index_ms = (g_get_monotonic_time() - t0) / 1000.0;
+
+        t0 = g_get_monotonic_time();
+        argsort(original_data, N, element_size, compare_func, sort_funcs[i], TRUE, indices);
+        double prefix_ms = (g_get_monotonic_time() - t0) / 1000.0;
+
+        // Application de la permutation sur une copie (une seule passe)
+        memcpy(work, original_data, total_size);
+        t0 = g_get_monotonic_time();
+        apply_permutation(work, N, element_size, indices);
+        double permute_ms = (g_get_monotonic_time() - t0) / 1000.0;
+
+        g_string_append_printf(output, "%-20s %9.3f ms %9.3f ms %9.3f ms %9.3f ms %9.3f ms\n",
+                               METHOD_NAMES[i], direct_ms, index_ms, prefix_ms, permute_ms, prefix_ms + permute_ms);
+    }
+
+    g_string_append(output, "\nIndices: permutation seule (données intactes). Ind.+préf.: indices accompagnés d'un "
+                            "préfixe de clé de 8 octets. Total ind.: argsort avec préfixes + permutation appliquée.\n");
+
+    const gchar *source_label = (app_data->input_source == 1) ? "Tableau Non Trié (Manuel)" : "Tableau Non Trié (Aléatoire)";
+    display_array_in_view(GTK_WIDGET(app_data->unsorted_view), original_data, N, element_size, app_data->current_type, source_label);
+    gtk_text_buffer_set_text(buffer, output->str, -1);
+
+    g_string_free(output, TRUE);
+    free(work);
+    free(indices);
+}
+
+// --- Export des points de courbe (temps + mémoire) au format CSV ---
+static void on_export_curve_clicked(GtkWidget *widget, gpointer data) {
+    AppData *app_data = (AppData *)data;
+
+    if (!app_data->curves_computed) {
+        show_error_dialog(app_data->parent_window, "Aucune donnée",
+            "Veuillez d'abord calculer les courbes avant de les exporter.");
+        return;
+    }
+
+    GtkWidget *dialog = gtk_file_chooser_dialog_new("Exporter les courbes (CSV)",
+        GTK_WINDOW(gtk_widget_get_toplevel(widget)),
+        GTK_FILE_CHOOSER_ACTION_SAVE,
+        "_Annuler", GTK_RESPONSE_CANCEL,
+        "_Enregistrer", GTK_RESPONSE_ACCEPT,
+        NULL);
+    gtk_file_chooser_set_do_overwrite_confirmation(GTK_FILE_CHOOSER(dialog), TRUE);
+    gtk_file_chooser_set_current_name(GTK_FILE_CHOOSER(dialog), "courbes_tri.csv");
+
+    if (gtk_dialog_run(GTK_DIALOG(dialog)) == GTK_RESPONSE_ACCEPT) {
+        gchar *filename = gtk_file_chooser_get_filename(GTK_FILE_CHOOSER(dialog));
+
+        GString *csv = g_string_new("methode;N;temps_s;mesure;modele;mem_aux_pic_octets;mem_aux_cumul_octets;allocations;profondeur_pile;pile_octets;delta_rss_pic_kio\n");
+        for (int i = 0; i < 4; i++) {
+            for (int j = 0; j < 5; j++) {
+                int N_val = app_data->comparison_N[j];
+                const SortMemoryStats *memory = &app_data->comparison_memory[i][j];
+                // Les points non mesurés (budget dépassé) portent la valeur extrapolée
+                g_string_append_printf(csv, "%s;%d;%.6f;%d;%s;%lu;%lu;%lu;%d;%lu;%ld\n",
+                    METHOD_NAMES[i], N_val, app_data->comparison_times[i][j],
+                    app_data->comparison_measured[i][j] ? 1 : 0, FIT_MODEL_NAMES[app_data->fit_model[i]],
+                    (unsigned long)memory->aux_peak_bytes, (unsigned long)memory->aux_total_bytes,
+                    (unsigned long)memory->alloc_count, memory->peak_depth,
+                    (unsigned long)memory->peak_stack_bytes, memory->rss_delta_kb);
+            }
+        }
+
+        GError *error = NULL;
+        if (!g_file_set_contents(filename, csv->str, csv->len, &error)) {
+            show_error_dialog(app_data->parent_window, "Erreur d'export", error->message);
+            g_error_free(error);
+        }
+
+        g_string_free(csv, TRUE);
+        g_free(filename);
+    }
+
+    gtk_widget_destroy(dialog);
+}
+
 static void on_show_curve_clicked(GtkWidget *widget, gpointer data) {
     AppData *app_data = (AppData *)data;
 
@@ -997,33 +2343,15 @@ static gboolean draw_callback(GtkWidget *widget, cairo_t *cr, gpointer data) {
     cairo_set_source_rgb(cr, 1.0, 1.0, 1.0); // Blanc
     cairo_paint(cr);
 
-    // SIMULATION SIMPLE : Générer TOUJOURS des valeurs pour les 4 courbes
-    // Le plus important : AFFICHER 4 COURBES VISIBLES qui commencent depuis (0,0)
-    // Simulation simple avec des valeurs progressives pour chaque méthode
-
-    for (int i = 0; i < 4; i++) {
-        for (int j = 0; j < 5; j++) {
-            // Valeurs simulées simples et progressives
-            // i=0: Bubble (plus lent), i=1: Insertion, i=2: Shell, i=3: Quick (plus rapide)
-            // j=0: 1x, j=1: 2x, j=2: 3x, j=3: 4x, j=4: 5x
-            // Les courbes commencent depuis (0,0) donc les valeurs à j=0 sont pour le point 1x
-
-            double base_value = 0.01; // Valeur de base en secondes
-
-            if (i == 0) {
-                // Bubble Sort - La plus lente - croissance rapide
-                app_data->comparison_times[i][j] = base_value * (j + 1) * (j + 1) * 2.0;
-            } else if (i == 1) {
-                // Insertion Sort - Plus rapide que Bubble
-                app_data->comparison_times[i][j] = base_value * (j + 1) * (j + 1) * 1.5;
-            } else if (i == 2) {
-                // Shell Sort - Intermédiaire - croissance modérée
-                app_data->comparison_times[i][j] = base_value * (j + 1) * 1.8;
-            } else {
-                // Quick Sort - La plus rapide - croissance lente
-                app_data->comparison_times[i][j] = base_value * (j + 1) * 0.5;
-            }
-        }
+    if (!app_data->curves_computed) {
+        cairo_set_source_rgb(cr, 0.3, 0.3, 0.3);
+        cairo_set_font_size(cr, 14);
+        const char *message = "Aucune mesure: utilisez \"Calculer les Courbes\" avant d'afficher le graphique.";
+        cairo_text_extents_t msg_ext;
+        cairo_text_extents(cr, message, &msg_ext);
+        cairo_move_to(cr, width/2.0 - msg_ext.width/2, height/2.0);
+        cairo_show_text(cr, message);
+        return TRUE;
     }
 
     // Trouver le temps maximum pour l'échelle du graphique
@@ -1096,6 +2424,7 @@ static gboolean draw_callback(GtkWidget *widget, cairo_t *cr, gpointer data) {
         double x = padding + (i + 1) * graph_width / 5.0;
         int N_val = start_N * (i + 1);
         if (N_val > MAX_N) N_val = MAX_N;
+        if (app_data->curves_computed) N_val = app_data->comparison_N[i]; // Tailles mesurées
         char buf[32];
         snprintf(buf, 32, "%d", N_val);
 
@@ -1158,19 +2487,39 @@ static gboolean draw_callback(GtkWidget *widget, cairo_t *cr, gpointer data) {
         // Point de départ à l'origine (padding, height - padding)
         cairo_move_to(cr, padding, height - padding);
 
-        // Dessiner la ligne depuis l'origine vers tous les points (1x, 2x, 3x, 4x, 5x)
-        for (int j = 0; j < 5; j++) {
+        // Partie mesurée: trait plein depuis l'origine jusqu'au dernier point mesuré
+        int last_measured = -1;
+        for (int j = 0; j < 5 && app_data->comparison_measured[i][j]; j++) {
             double x = padding + (j + 1) * graph_width / 5.0;
             double time_val = app_data->comparison_times[i][j];
             if (time_val < 0.0) time_val = 0.0;
             double y = height - padding - (time_val / max_time * graph_height);
             cairo_line_to(cr, x, y);
+            last_measured = j;
         }
         cairo_stroke(cr);
 
-        // Dessiner les points de données pour cette courbe (sans le point à l'origine)
+        // Partie extrapolée (modèle ajusté): pointillés jusqu'au plus grand N
+        if (last_measured < 4) {
+            double dashes[] = {8.0, 6.0};
+            cairo_set_dash(cr, dashes, 2, 0.0);
+            cairo_set_line_width(cr, 2.0);
+            double x0 = padding + (last_measured + 1) * graph_width / 5.0;
+            double t0 = (last_measured >= 0) ? app_data->comparison_times[i][last_measured] : 0.0;
+            cairo_move_to(cr, x0, height - padding - (t0 / max_time * graph_height));
+            for (int j = last_measured + 1; j < 5; j++) {
+                double x = padding + (j + 1) * graph_width / 5.0;
+                double y = height - padding - (app_data->comparison_times[i][j] / max_time * graph_height);
+                cairo_line_to(cr, x, y);
+            }
+            cairo_stroke(cr);
+            cairo_set_dash(cr, NULL, 0, 0.0);
+            cairo_set_line_width(cr, 3.0);
+        }
+
+        // Dessiner les points mesurés pour cette courbe (sans le point à l'origine)
         cairo_set_source_rgb(cr, r, g, b);
-        for (int j = 0; j < 5; j++) {
+        for (int j = 0; j <= last_measured; j++) {
             double x = padding + (j + 1) * graph_width / 5.0;
             double time_val = app_data->comparison_times[i][j];
             if (time_val < 0.0) time_val = 0.0;
@@ -1197,12 +2546,14 @@ static gboolean draw_callback(GtkWidget *widget, cairo_t *cr, gpointer data) {
     double leg_y = padding + 20;
 
     // Legend Box (fond clair avec bordure pour fond blanc)
+    // Legend Box élargie pour afficher le modèle ajusté de chaque méthode
+    leg_x = width - 250;
     cairo_set_source_rgba(cr, 0.15, 0.15, 0.18, 0.9); // Fond sombre semi-transparent
-    cairo_rectangle(cr, leg_x - 10, leg_y - 10, 140, 100);
+    cairo_rectangle(cr, leg_x - 10, leg_y - 10, 240, 100);
     cairo_fill(cr);
     cairo_set_source_rgb(cr, 0.6, 0.6, 0.6); // Bordure grise claire pour fond sombre
     cairo_set_line_width(cr, 1.0);
-    cairo_rectangle(cr, leg_x - 10, leg_y - 10, 140, 100);
+    cairo_rectangle(cr, leg_x - 10, leg_y - 10, 240, 100);
     cairo_stroke(cr);
 
     // Légende : afficher les 4 méthodes avec leurs couleurs respectives
@@ -1219,7 +2570,10 @@ static gboolean draw_callback(GtkWidget *widget, cairo_t *cr, gpointer data) {
 
         cairo_set_source_rgb(cr, 1.0, 1.0, 1.0); // Texte blanc pour fond sombre
         cairo_move_to(cr, leg_x + 20, leg_y + i * 20 + 10);
-        cairo_show_text(cr, METHOD_NAMES[i]);
+        char legend[96];
+        snprintf(legend, sizeof(legend), "%s (%.2e·%s)", METHOD_NAMES[i],
+                 app_data->fit_constant[i], FIT_MODEL_NAMES[app_data->fit_model[i]]);
+        cairo_show_text(cr, legend);
     }
 
     return TRUE;
@@ -1403,6 +2757,15 @@ static void create_array_window(GtkWidget *parent_window) {
         gtk_grid_attach(GTK_GRID(single_sort_grid), btn, 0, i, 1, 1);
     }
 
+    GtkWidget *argsort_toggle = gtk_check_button_new_with_label("🧭 Mode indirect (argsort sur indices)");
+    gtk_grid_attach(GTK_GRID(single_sort_grid), argsort_toggle, 0, 4, 1, 1);
+    app_data->argsort_toggle = argsort_toggle;
+
+    GtkWidget *argsort_prefix_toggle = gtk_check_button_new_with_label("Préfixes de clés en cache");
+    gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(argsort_prefix_toggle), TRUE);
+    gtk_grid_attach(GTK_GRID(single_sort_grid), argsort_prefix_toggle, 0, 5, 1, 1);
+    app_data->argsort_prefix_toggle = argsort_prefix_toggle;
+
     // Onglet 2 : Comparaison
     GtkWidget *comparison_vbox = gtk_box_new(GTK_ORIENTATION_VERTICAL, 12);
     gtk_container_set_border_width(GTK_CONTAINER(comparison_vbox), 15);
@@ -1415,6 +2778,17 @@ static void create_array_window(GtkWidget *parent_window) {
     g_signal_connect(btn_compare_current, "clicked", G_CALLBACK(on_comparison_execute_current_n_clicked), app_data);
     gtk_box_pack_start(GTK_BOX(comparison_vbox), btn_compare_current, FALSE, FALSE, 0);
 
+    GtkWidget *budget_box = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 10);
+    gtk_box_pack_start(GTK_BOX(comparison_vbox), budget_box, FALSE, FALSE, 0);
+    gtk_box_pack_start(GTK_BOX(budget_box), gtk_label_new("Budget par méthode (s):"), FALSE, FALSE, 0);
+    GtkWidget *budget_input = gtk_spin_button_new_with_range(0.1, 600.0, 0.5);
+    gtk_spin_button_set_digits(GTK_SPIN_BUTTON(budget_input), 1);
+    gtk_spin_button_set_value(GTK_SPIN_BUTTON(budget_input), 5.0);
+    // Style CSS activé
+    gtk_style_context_add_class(gtk_widget_get_style_context(budget_input), "modern-spin");
+    gtk_box_pack_start(GTK_BOX(budget_box), budget_input, TRUE, TRUE, 0);
+    app_data->curve_budget_input = GTK_SPIN_BUTTON(budget_input);
+
     GtkWidget *btn_calculate_curve = gtk_button_new_with_label("📊 Calculer les Courbes (5 points)");
     // Style CSS activé
     gtk_style_context_add_class(gtk_widget_get_style_context(btn_calculate_curve), "modern-button");
@@ -1427,6 +2801,40 @@ static void create_array_window(GtkWidget *parent_window) {
     g_signal_connect(btn_show_curve, "clicked", G_CALLBACK(on_show_curve_clicked), app_data);
     gtk_box_pack_start(GTK_BOX(comparison_vbox), btn_show_curve, FALSE, FALSE, 0);
 
+    GtkWidget *btn_argsort_bench = gtk_button_new_with_label("🧭 Argsort vs Tri Direct");
+    // Style CSS activé
+    gtk_style_context_add_class(gtk_widget_get_style_context(btn_argsort_bench), "modern-button");
+    g_signal_connect(btn_argsort_bench, "clicked", G_CALLBACK(on_argsort_benchmark_clicked), app_data);
+    gtk_box_pack_start(GTK_BOX(comparison_vbox), btn_argsort_bench, FALSE, FALSE, 0);
+
+    GtkWidget *btn_export_curve = gtk_button_new_with_label("💾 Exporter les Courbes (CSV)");
+    // Style CSS activé
+    gtk_style_context_add_class(gtk_widget_get_style_context(btn_export_curve), "modern-button");
+    g_signal_connect(btn_export_curve, "clicked", G_CALLBACK(on_export_curve_clicked), app_data);
+    gtk_box_pack_start(GTK_BOX(comparison_vbox), btn_export_curve, FALSE, FALSE, 0);
+
+    // Onglet 3 : Sélection (statistiques d'ordre / Top-k)
+    GtkWidget *selection_vbox = gtk_box_new(GTK_ORIENTATION_VERTICAL, 12);
+    gtk_container_set_border_width(GTK_CONTAINER(selection_vbox), 15);
+    GtkWidget *label_select = gtk_label_new("🎯 Sélection");
+    gtk_notebook_append_page(GTK_NOTEBOOK(action_notebook), selection_vbox, label_select);
+
+    GtkWidget *k_box = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 10);
+    gtk_box_pack_start(GTK_BOX(selection_vbox), k_box, FALSE, FALSE, 0);
+    gtk_box_pack_start(GTK_BOX(k_box), gtk_label_new("k (Top-k):"), FALSE, FALSE, 0);
+    GtkWidget *k_input = gtk_spin_button_new_with_range(1, MAX_N, 1);
+    gtk_spin_button_set_value(GTK_SPIN_BUTTON(k_input), 10);
+    // Style CSS activé
+    gtk_style_context_add_class(gtk_widget_get_style_context(k_input), "modern-spin");
+    gtk_box_pack_start(GTK_BOX(k_box), k_input, TRUE, TRUE, 0);
+    app_data->selection_k_input = GTK_SPIN_BUTTON(k_input);
+
+    GtkWidget *btn_selection = gtk_button_new_with_label("🎯 Statistiques d'Ordre et Top-k");
+    // Style CSS activé
+    gtk_style_context_add_class(gtk_widget_get_style_context(btn_selection), "modern-button");
+    g_signal_connect(btn_selection, "clicked", G_CALLBACK(on_selection_clicked), app_data);
+    gtk_box_pack_start(GTK_BOX(selection_vbox), btn_selection, FALSE, FALSE, 0);
+
     gtk_paned_pack1(GTK_PANED(main_paned), control_scrolled, FALSE, FALSE);
 
     // ========== PANEL DROIT : AFFICHAGE DES RÉSULTATS MODERNES ==========
@@ -1519,6 +2927,11 @@ void create_curve_window(GtkWidget *parent_window, AppData *app_data) {
 
     AppData *curve_data = g_new0(AppData, 1);
     memcpy(curve_data->comparison_times, app_data->comparison_times, sizeof(app_data->comparison_times));
+    memcpy(curve_data->comparison_measured, app_data->comparison_measured, sizeof(app_data->comparison_measured));
+    memcpy(curve_data->fit_model, app_data->fit_model, sizeof(app_data->fit_model));
+    memcpy(curve_data->fit_constant, app_data->fit_constant, sizeof(app_data->fit_constant));
+    memcpy(curve_data->comparison_N, app_data->comparison_N, sizeof(app_data->comparison_N));
+    curve_data->curves_computed = app_data->curves_computed;
 
     // Utiliser N_initial si défini, sinon utiliser une valeur par défaut
     if (app_data->N_initial > 0) {
@@ -1549,7 +2962,18 @@ void create_curve_window(GtkWidget *parent_window, AppData *app_data) {
 
 // Fonctions de base des Listes
 static List *list_new(const gchar *structure_type, const gchar *element_type);
-static void free_node_data(Node *node, const gchar *type);
+static void free_node_data(List *list, Node *node);
+static gboolean list_is_unrolled(const List *list);
+static void unrolled_insert(List *list, const void *value, size_t index);
+static void unrolled_delete(List *list, size_t index);
+static void *unrolled_value_at(List *list, size_t index);
+static void unrolled_free(List *list);
+static gboolean list_is_skip(const List *list);
+static void skip_insert(List *list, const void *value);
+static void skip_delete(List *list, size_t index);
+static SkipNode *skip_at(List *list, size_t index);
+static gboolean skip_contains(List *list, const void *value);
+static void skip_free(List *list);
 static void list_free(List *list);
 static void list_insert_int(List *list, int value, int index);
 static void list_delete(List *list, int index);
@@ -1563,6 +2987,7 @@ static void list_bubble_sort(List *list);
 static void list_insertion_sort(List *list);
 static void list_shell_sort(List *list);
 static void list_quick_sort(List *list);
+static void list_merge_sort(List *list);
 static Node *list_quick_partition(List *list, int low_index, int high_index);
 static void list_quick_sort_recursive(List *list, int low_index, int high_index);
 
@@ -1583,11 +3008,303 @@ static void on_list_sort_clicked(GtkWidget *widget, gpointer data);
 static void create_list_window(GtkWidget *parent_window);
 
 
+// --- [LISTES] --- Ensemble de hachage des valeurs (unicité en O(1)) ---
+
+#define LIST_HASH_MIN_CAPACITY 64
+
+// Clé normalisée d'une valeur selon le type de la liste
+static guint64 list_hash_key(const List *list, const void *value) {
+    if (list->compare_func == compare_float) {
+        float f = *(const float *)value;
+        if (f == 0.0f) f = 0.0f; // -0.0 et 0.0 sont égaux pour compare_float
+        guint32 bits;
+        memcpy(&bits, &f, sizeof(bits));
+        return bits;
+    }
+    if (list->compare_func == compare_char) return (guchar)*(const char *)value;
+    if (list->compare_func == compare_string) {
+        // FNV-1a 64 bits sur le contenu de la chaîne
+        const unsigned char *str = *(const unsigned char **)value;
+        guint64 hash = 0xcbf29ce484222325ULL;
+        for (; str && *str; str++) hash = (hash ^ *str) * 0x100000001b3ULL;
+        return hash;
+    }
+    return (guint32)*(const int *)value;
+}
+
+// Case contenant la valeur, ou première case libre de la séquence de sondage
+static size_t list_hash_find_slot(const List *list, const ListHashSet *set, guint64 key, const void *value) {
+    gboolean is_string = (list->compare_func == compare_string);
+    size_t mask = set->capacity - 1;
+    size_t slot = (size_t)verify_mix64(key) & mask;
+
+    while (set->entries[slot].count != 0) {
+        const ListHashEntry *entry = &set->entries[slot];
+        if (entry->key == key && (!is_string || strcmp(entry->string, *(const char **)value) == 0)) {
+            return slot;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+// Agrandit la table pour contenir 'needed' valeurs distinctes sous le facteur de charge 1/2
+static void list_hash_grow(const List *list, ListHashSet *set, size_t needed) {
+    size_t new_capacity = set->capacity ? set->capacity * 2 : LIST_HASH_MIN_CAPACITY;
+    while (needed * 2 > new_capacity) new_capacity *= 2;
+    ListHashEntry *old_entries = set->entries;
+    size_t old_capacity = set->capacity;
+
+    set->entries = g_new0(ListHashEntry, new_capacity);
+    set->capacity = new_capacity;
+
+    size_t mask = new_capacity - 1;
+    for (size_t i = 0; i < old_capacity; i++) {
+        if (old_entries[i].count == 0) continue;
+        size_t slot = (size_t)verify_mix64(old_entries[i].key) & mask;
+        while (set->entries[slot].count != 0) slot = (slot + 1) & mask;
+        set->entries[slot] = old_entries[i];
+    }
+    g_free(old_entries);
+}
+
+static void list_hash_add(List *list, const void *value) {
+    if (list->value_set_stale) return; // Sera reconstruit en entier
+    ListHashSet *set = &list->value_set;
+    // Facteur de charge maximal 1/2: sondages courts
+    if ((set->used + 1) * 2 > set->capacity) list_hash_grow(list, set, set->used + 1);
+
+    guint64 key = list_hash_key(list, value);
+    size_t slot = list_hash_find_slot(list, set, key, value);
+    ListHashEntry *entry = &set->entries[slot];
+    if (entry->count == 0) {
+        entry->key = key;
+        entry->string = (list->compare_func == compare_string) ? g_strdup(*(const char **)value) : NULL;
+        set->used++;
+    }
+    entry->count++;
+}
+
+static void list_hash_remove(List *list, const void *value) {
+    ListHashSet *set = &list->value_set;
+    if (list->value_set_stale || set->capacity == 0) return;
+
+    size_t slot = list_hash_find_slot(list, set, list_hash_key(list, value), value);
+    ListHashEntry *entry = &set->entries[slot];
+    if (entry->count == 0 || --entry->count > 0) return;
+
+    g_free(entry->string);
+    entry->string = NULL;
+    set->used--;
+
+    // Suppression par décalage arrière (pas de pierres tombales)
+    size_t mask = set->capacity - 1;
+    size_t hole = slot;
+    size_t next = (hole + 1) & mask;
+    while (set->entries[next].count != 0) {
+        size_t home = (size_t)verify_mix64(set->entries[next].key) & mask;
+        // L'entrée peut combler le trou si sa case d'origine n'est pas dans ]hole, next]
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            set->entries[hole] = set->entries[next];
+            set->entries[next].count = 0;
+            set->entries[next].string = NULL;
+            hole = next;
+        }
+        next = (next + 1) & mask;
+    }
+}
+
+static gboolean list_hash_contains(const List *list, const void *value) {
+    const ListHashSet *set = &list->value_set;
+    if (set->capacity == 0) return FALSE;
+    size_t slot = list_hash_find_slot(list, set, list_hash_key(list, value), value);
+    return set->entries[slot].count != 0;
+}
+
+// Dimensionne la table en une fois avant un ajout groupé (pas de rehachages successifs)
+static void list_hash_reserve(List *list, size_t extra) {
+    ListHashSet *set = &list->value_set;
+    if (list->value_set_stale || (set->used + extra) * 2 <= set->capacity) return;
+    list_hash_grow(list, set, set->used + extra);
+}
+
+static void list_hash_clear(List *list) {
+    ListHashSet *set = &list->value_set;
+    // Seules les tables de chaînes possèdent des copies à libérer
+    if (list->compare_func == compare_string) {
+        for (size_t i = 0; i < set->capacity; i++) g_free(set->entries[i].string);
+    }
+    g_free(set->entries);
+    set->entries = NULL;
+    set->capacity = 0;
+    set->used = 0;
+}
+
+// Les opérations groupées (scission, concaténation, greffe) ne maintiennent pas l'ensemble
+// élément par élément: il est marqué périmé et reconstruit en un parcours à la recherche suivante.
+static void list_hash_invalidate(List *list) {
+    list_hash_clear(list);
+    list->value_set_stale = TRUE;
+}
+
+static void list_hash_rebuild(List *list) {
+    list_hash_clear(list);
+    list->value_set_stale = FALSE;
+    if (list_is_unrolled(list)) {
+        for (ListBlock *block = list->first_block; block; block = block->next) {
+            for (guint32 i = 0; i < block->count; i++) list_hash_add(list, block->items + i * list->element_size);
+        }
+        return;
+    }
+    for (Node *node = list->head; node; node = node->next) list_hash_add(list, node->data);
+}
+
+
+// --- [LISTES] --- Allocateur de nœuds par slabs ---
+
+#define NODE_SLAB_MIN_CAPACITY 64
+#define NODE_SLAB_MAX_CAPACITY 65536
+
+static NodePool *node_pool_new(void) {
+    NodePool *pool = g_new0(NodePool, 1);
+    pool->ref_count = 1;
+    return pool;
+}
+
+static Node *node_pool_alloc(NodePool *pool) {
+    Node *node;
+    if (pool->free_list) {
+        node = pool->free_list;
+        pool->free_list = node->next;
+        if (!pool->free_list) pool->free_tail = NULL;
+    } else {
+        if (!pool->slabs || pool->slab_used == pool->slabs->capacity) {
+            // Slabs de taille croissante: peu de blocs pour les grandes listes, peu de perte pour les petites
+            size_t capacity = pool->slabs ? MIN(pool->slabs->capacity * 2, NODE_SLAB_MAX_CAPACITY) : NODE_SLAB_MIN_CAPACITY;
+            size_t bytes = sizeof(NodeSlab) + capacity * sizeof(Node);
+            NodeSlab *slab = g_malloc(bytes);
+            slab->capacity = capacity;
+            slab->next = pool->slabs;
+            pool->slabs = slab;
+            pool->slab_used = 0;
+            pool->slab_count++;
+            pool->reserved_bytes += bytes;
+        }
+        node = &pool->slabs->nodes[pool->slab_used++];
+    }
+    memset(node, 0, sizeof(Node));
+    node->data = &node->payload;
+    return node;
+}
+
+// Réserve 'count' nœuds contigus en une seule allocation (construction groupée).
+// Le slab réservé est chaîné derrière le slab de tête, dont la place restante reste utilisable.
+static Node *node_pool_alloc_batch(NodePool *pool, size_t count) {
+    if (pool->slabs && pool->slabs->capacity - pool->slab_used >= count) {
+        Node *nodes = &pool->slabs->nodes[pool->slab_used];
+        pool->slab_used += count;
+        return nodes;
+    }
+    size_t bytes = sizeof(NodeSlab) + count * sizeof(Node);
+    NodeSlab *slab = g_malloc(bytes);
+    slab->capacity = count;
+    if (pool->slabs) {
+        slab->next = pool->slabs->next;
+        pool->slabs->next = slab;
+    } else {
+        // Pool vide: le slab devient la tête, entièrement distribué
+        slab->next = NULL;
+        pool->slabs = slab;
+        pool->slab_used = count;
+    }
+    pool->slab_count++;
+    pool->reserved_bytes += bytes;
+    return slab->nodes;
+}
+
+static void node_pool_free(NodePool *pool, Node *node) {
+    node->next = pool->free_list;
+    if (!pool->free_list) pool->free_tail = node;
+    pool->free_list = node;
+}
+
+// Rend une chaîne first..last (liée par next) à la liste libre en O(1)
+static void node_pool_free_chain(NodePool *pool, Node *first, Node *last) {
+    last->next = pool->free_list;
+    if (!pool->free_list) pool->free_tail = last;
+    pool->free_list = first;
+}
+
+// Transfère les slabs et les nœuds libres de 'src' (non partagé) dans 'dst', puis libère 'src'.
+// Coût proportionnel au nombre de slabs, pas au nombre de nœuds.
+static void node_pool_absorb(NodePool *dst, NodePool *src) {
+    if (src->slabs) {
+        NodeSlab *last = src->slabs;
+        while (last->next) last = last->next;
+        if (dst->slabs) {
+            // Les slabs de src passent derrière la tête de dst (leur place restante est perdue)
+            last->next = dst->slabs->next;
+            dst->slabs->next = src->slabs;
+        } else {
+            dst->slabs = src->slabs;
+            dst->slab_used = src->slab_used;
+        }
+        dst->slab_count += src->slab_count;
+        dst->reserved_bytes += src->reserved_bytes;
+    }
+    if (src->free_list) node_pool_free_chain(dst, src->free_list, src->free_tail);
+    g_free(src);
+}
+
+static void node_pool_release(NodePool *pool) {
+    NodeSlab *slab = pool->slabs;
+    while (slab) {
+        NodeSlab *next = slab->next;
+        g_free(slab);
+        slab = next;
+    }
+    g_free(pool);
+}
+
+// Estimation de l'ancien coût: un malloc pour le nœud et un pour la donnée,
+// chacun arrondi à 16 octets avec un en-tête de 8 octets (32 octets minimum, comme glibc).
+static size_t list_heap_chunk_bytes(size_t n) {
+    return MAX(32, (n + 8 + 15) & ~(size_t)15);
+}
+
+// Résumé mémoire affiché dans la vue d'information de la liste
+static gchar *list_memory_summary(const List *list) {
+    if (list_is_skip(list)) {
+        size_t links = 0;
+        for (SkipNode *node = list->skip_head ? list->skip_head->links[0].next : NULL; node; node = node->links[0].next) {
+            links += node->level;
+        }
+        double per_node = list->size ? (double)(list->size * sizeof(SkipNode) + links * sizeof(SkipLink)) / (double)list->size : 0.0;
+        return g_strdup_printf("Mémoire par nœud: %.1f o (tour moyenne de %.2f niveaux, %d niveau(x) actif(s))",
+                               per_node, list->size ? (double)links / (double)list->size : 0.0, list->skip_level);
+    }
+    if (list_is_unrolled(list)) {
+        double per_element = list->size ? (double)(list->block_count * UNROLLED_BLOCK_BYTES) / (double)list->size : 0.0;
+        guint32 capacity = (guint32)((UNROLLED_BLOCK_BYTES - sizeof(ListBlock)) / list->element_size);
+        return g_strdup_printf("Mémoire par élément: %.1f o (%zu bloc(s) de %d o, %u éléments max par bloc)",
+                               per_element, list->block_count, UNROLLED_BLOCK_BYTES, capacity);
+    }
+    size_t before = list_heap_chunk_bytes(3 * sizeof(void *)) + list_heap_chunk_bytes(list->element_size);
+    double after = list->size ? (double)list->pool->reserved_bytes / (double)list->size : (double)sizeof(Node);
+    gboolean is_string = g_strcmp0(list->element_type, "Chaîne de Caractères") == 0;
+    return g_strdup_printf("Mémoire par nœud: %zu o (2 allocations) → %.1f o (slab, %zu o utiles, %zu slab(s))%s",
+                           before, after, sizeof(Node), list->pool->slab_count,
+                           is_string ? " + chaîne sur le tas" : "");
+}
+
+
 // --- [LISTES] --- Fonctions de base des Listes (Inchangées) ---
 
 static List *list_new(const gchar *structure_type, const gchar *element_type) {
     List *list = g_new0(List, 1);
+    list->pool = node_pool_new();
     list->head = NULL;
+    list->tail = NULL;
     list->size = 0;
     list->structure_type = structure_type;
     list->element_type = element_type;
@@ -1596,23 +3313,30 @@ static List *list_new(const gchar *structure_type, const gchar *element_type) {
     return list;
 }
 
-static void free_node_data(Node *node, const gchar *type) {
-    if (g_strcmp0(type, "Chaîne de Caractères") == 0) {
-        if (node->data) free(*(char **)node->data);
+static void free_node_data(List *list, Node *node) {
+    if (g_strcmp0(list->element_type, "Chaîne de Caractères") == 0) {
+        g_free(node->payload.s);
     }
-    free(node->data);
-    free(node);
+    node_pool_free(list->pool, node);
 }
 
 static void list_free(List *list) {
     if (!list) return;
-    Node *current = list->head;
-    Node *next;
-    while (current != NULL) {
-        next = current->next;
-        free_node_data(current, list->element_type);
-        current = next;
+    unrolled_free(list);
+    skip_free(list);
+    // Seules les chaînes possèdent de la mémoire hors slab: les autres types sont rendus en bloc
+    if (g_strcmp0(list->element_type, "Chaîne de Caractères") == 0) {
+        for (Node *current = list->head; current != NULL; current = current->next) {
+            g_free(current->payload.s);
+        }
     }
+    if (--list->pool->ref_count == 0) {
+        node_pool_release(list->pool);
+    } else if (list->head) {
+        // Pool partagé avec une autre liste: la chaîne retourne d'un bloc dans la liste libre
+        node_pool_free_chain(list->pool, list->head, list->tail);
+    }
+    list_hash_clear(list);
     g_free(list);
 }
 
@@ -1620,46 +3344,43 @@ static void list_free(List *list) {
 static void list_insert_generic(List *list, void *value, int index) {
     if (!list || !value) return;
     if (index < 0 || index > list->size) index = list->size;
-
-    Node *new_node = g_new0(Node, 1);
-    if (!new_node) return; // Échec d'allocation
-
-    void *data = malloc(list->element_size);
-    if (!data) {
-        g_free(new_node); // Libérer le nœud si l'allocation de données échoue
+    if (list_is_unrolled(list)) {
+        unrolled_insert(list, value, (size_t)index);
+        return;
+    }
+    if (list_is_skip(list)) {
+        skip_insert(list, value); // La position est imposée par l'ordre des valeurs
         return;
     }
 
+    // Nœud pris dans les slabs de la liste, donnée stockée en place (payload)
+    Node *new_node = node_pool_alloc(list->pool);
+
     if (g_strcmp0(list->element_type, "Chaîne de Caractères") == 0) {
-        // Pour les chaînes, on copie le pointeur
-        char **str_ptr = (char **)data;
-        *str_ptr = g_strdup(*(const char **)value);
-        if (!*str_ptr) {
-            free(data);
-            g_free(new_node);
-            return; // Échec d'allocation de la chaîne
-        }
+        // Pour les chaînes, on stocke une copie possédée par le nœud
+        new_node->payload.s = g_strdup(*(const char **)value);
     } else {
         // Pour les autres types, on copie la valeur
-        memcpy(data, value, list->element_size);
+        memcpy(new_node->data, value, list->element_size);
     }
 
-    new_node->data = data;
-    new_node->next = NULL;
-    new_node->prev = NULL;
-
     if (index == 0) {
         new_node->next = list->head;
         if (list->head && g_strcmp0(list->structure_type, "Liste Double") == 0) {
             list->head->prev = new_node;
         }
         list->head = new_node;
-    } else {
-        Node *current = list->head;
-        for (int i = 0; i < index - 1; i++) {
-            if (current == NULL) break;
-            current = current->next;
+        if (!list->tail) list->tail = new_node;
+    } else if (index == list->size) {
+        // Ajout en fin en O(1) grâce au pointeur de queue
+        if (g_strcmp0(list->structure_type, "Liste Double") == 0) {
+            new_node->prev = list->tail;
         }
+        list->tail->next = new_node;
+        list->tail = new_node;
+    } else {
+        // Prédécesseur atteint depuis l'extrémité ou le curseur le plus proche
+        Node *current = get_node_at(list, index - 1);
 
         if (current) {
             new_node->next = current->next;
@@ -1671,25 +3392,22 @@ static void list_insert_generic(List *list, void *value, int index) {
             }
             current->next = new_node;
         } else {
-            free_node_data(new_node, list->element_type);
+            free_node_data(list, new_node);
             return;
         }
     }
+    // Le curseur désigne le même nœud, décalé d'un rang s'il est après le point d'insertion
+    if (list->cursor && list->cursor_index >= index) list->cursor_index++;
     list->size++;
+    list_hash_add(list, new_node->data);
 }
 
-// Fonction helper pour vérifier si une valeur existe déjà dans la liste
+// Fonction helper pour vérifier si une valeur existe déjà dans la liste (O(1) via l'ensemble de hachage)
 static gboolean list_contains_value(List *list, void *value) {
     if (!list || !value || !list->compare_func) return FALSE;
-
-    Node *current = list->head;
-    while (current != NULL) {
-        if (list->compare_func(current->data, value) == 0) {
-            return TRUE; // Valeur trouvée
-        }
-        current = current->next;
-    }
-    return FALSE; // Valeur non trouvée
+    if (list_is_skip(list)) return skip_contains(list, value); // Recherche en O(log n) dans la liste triée
+    if (list->value_set_stale) list_hash_rebuild(list);
+    return list_hash_contains(list, value);
 }
 
 // Fonction de compatibilité pour les entiers (pour ne pas casser le code existant)
@@ -1698,52 +3416,100 @@ static void list_insert_int(List *list, int value, int index) {
 }
 
 static void list_delete(List *list, int index) {
-    if (!list->head || index < 0 || index >= list->size) return;
+    if (index < 0 || index >= list->size) return;
+    if (list_is_unrolled(list)) {
+        unrolled_delete(list, (size_t)index);
+        return;
+    }
+    if (list_is_skip(list)) {
+        skip_delete(list, (size_t)index);
+        return;
+    }
+    if (!list->head) return;
 
     Node *to_delete = NULL;
+    gboolean is_double = g_strcmp0(list->structure_type, "Liste Double") == 0;
     if (index == 0) {
         to_delete = list->head;
         list->head = list->head->next;
-        if (list->head && g_strcmp0(list->structure_type, "Liste Double") == 0) {
+        if (list->head && is_double) {
             list->head->prev = NULL;
         }
+        if (!list->head) list->tail = NULL;
+    } else if (is_double && index == list->size - 1) {
+        // Suppression en fin en O(1): le prédécesseur est connu via prev
+        to_delete = list->tail;
+        list->tail = to_delete->prev;
+        list->tail->next = NULL;
     } else {
-        Node *current = list->head;
-        for (int i = 0; i < index - 1; i++) {
-            current = current->next;
-            if (current == NULL || current->next == NULL) return;
-        }
+        Node *current = get_node_at(list, index - 1);
+        if (current == NULL || current->next == NULL) return;
         to_delete = current->next;
         current->next = to_delete->next;
 
-        if (g_strcmp0(list->structure_type, "Liste Double") == 0) {
+        if (is_double) {
             if (to_delete->next) {
                 to_delete->next->prev = current;
             }
         }
+        if (to_delete == list->tail) list->tail = current;
     }
 
     if (to_delete) {
-        free_node_data(to_delete, list->element_type);
+        if (list->cursor == to_delete) list->cursor = NULL;
+        else if (list->cursor && list->cursor_index > index) list->cursor_index--;
+        list_hash_remove(list, to_delete->data);
+        free_node_data(list, to_delete);
         list->size--;
     }
 }
 
 // --- Fonctions utilitaires de tri (Inchangées) ---
 
+// Accès par index depuis le plus proche de: tête, curseur, queue.
+// Les listes doubles peuvent reculer via prev; les listes simples n'avancent que depuis
+// la tête ou un curseur situé avant l'index (la queue ne sert que pour le dernier élément).
 static Node *get_node_at(List *list, int index) {
     if (index < 0 || index >= list->size) return NULL;
+    gboolean is_double = g_strcmp0(list->structure_type, "Liste Double") == 0;
+    int last = (int)list->size - 1;
+
     Node *current = list->head;
-    for (int i = 0; i < index; i++) {
+    int current_index = 0;
+    int best = index; // Pas depuis la tête
+
+    if (list->cursor) {
+        int distance = index - list->cursor_index;
+        if ((distance >= 0 || is_double) && abs(distance) < best) {
+            current = list->cursor;
+            current_index = list->cursor_index;
+            best = abs(distance);
+        }
+    }
+    if ((is_double || index == last) && last - index < best) {
+        current = list->tail;
+        current_index = last;
+    }
+
+    while (current_index < index) {
         current = current->next;
+        current_index++;
     }
+    while (current_index > index) {
+        current = current->prev;
+        current_index--;
+    }
+
+    list->cursor = current;
+    list->cursor_index = index;
     return current;
 }
 
+// Les données sont en place: on échange les charges utiles (8 octets), pas les pointeurs
 static void swap_node_data(Node *a, Node *b) {
-    void *temp_data = a->data;
-    a->data = b->data;
-    b->data = temp_data;
+    NodePayload temp = a->payload;
+    a->payload = b->payload;
+    b->payload = temp;
 }
 
 // --- [LISTES] --- Fonctions de Tri ---
@@ -1772,23 +3538,41 @@ static void list_bubble_sort(List *list) {
 static void list_insertion_sort(List *list) {
     if (!list || list->size <= 1) return;
 
-    // Cette implémentation par permutation de données fonctionne mieux sur les listes doubles.
-    Node *sorted_end = list->head;
+    // Liste simple (pas de prev): la valeur à insérer est propagée vers l'avant,
+    // du point d'insertion jusqu'à sa position d'origine.
+    if (g_strcmp0(list->structure_type, "Liste Double") != 0) {
+        for (Node *unsorted_node = list->head->next; unsorted_node != NULL; unsorted_node = unsorted_node->next) {
+            Node *position = list->head;
+            while (position != unsorted_node && list->compare_func(position->data, unsorted_node->data) <= 0) {
+                position = position->next;
+            }
+            NodePayload carry = unsorted_node->payload;
+            for (; position != unsorted_node->next; position = position->next) {
+                NodePayload temp = position->payload;
+                position->payload = carry;
+                carry = temp;
+            }
+        }
+        return;
+    }
+
+    // Cette implémentation par permutation de données fonctionne mieux sur les listes doubles.
+    Node *sorted_end = list->head;
 
     while (sorted_end->next != NULL) {
         Node *unsorted_node = sorted_end->next;
 
         if (list->compare_func(unsorted_node->data, list->head->data) < 0) {
-            void *key_data = unsorted_node->data;
+            NodePayload key_data = unsorted_node->payload;
             Node *temp_ptr = unsorted_node;
 
             while(temp_ptr != list->head) {
                 // Nécessite le champ 'prev' (Liste Double)
                 if (g_strcmp0(list->structure_type, "Liste Double") != 0 || !temp_ptr->prev) break;
-                temp_ptr->data = temp_ptr->prev->data;
+                temp_ptr->payload = temp_ptr->prev->payload;
                 temp_ptr = temp_ptr->prev;
             }
-            list->head->data = key_data;
+            list->head->payload = key_data;
 
         } else if (list->compare_func(unsorted_node->data, sorted_end->data) < 0) {
             Node *current_sorted = list->head;
@@ -1797,16 +3581,16 @@ static void list_insertion_sort(List *list) {
                 current_sorted = current_sorted->next;
             }
 
-            void *key_data = unsorted_node->data;
+            NodePayload key_data = unsorted_node->payload;
             Node *i = unsorted_node;
 
             while (i != current_sorted->next) {
                  // Nécessite le champ 'prev' (Liste Double)
                 if (g_strcmp0(list->structure_type, "Liste Double") != 0 || !i->prev) break;
-                i->data = i->prev->data;
+                i->payload = i->prev->payload;
                 i = i->prev;
             }
-            current_sorted->next->data = key_data;
+            current_sorted->next->payload = key_data;
         }
 
         sorted_end = sorted_end->next;
@@ -1877,446 +3661,2593 @@ static void list_quick_sort(List *list) {
     list_quick_sort_recursive(list, 0, list->size - 1);
 }
 
+// Fusionne deux suites triées (terminées par NULL) et retourne la tête du résultat.
+// À égalité, le nœud de 'left' passe d'abord: le tri reste stable.
+static Node *list_merge_runs(List *list, Node *left, Node *right) {
+    Node dummy = {0};
+    Node *tail = &dummy;
+    while (left && right) {
+        if (list->compare_func(right->data, left->data) < 0) {
+            tail->next = right;
+            right = right->next;
+        } else {
+            tail->next = left;
+            left = left->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = left ? left : right;
+    return dummy.next;
+}
 
-// --- [LISTES] --- Fonctions de Dessin et Callback (Inchangées) ---
+// Tri fusion ascendant: O(n log n), stable, sans accès par index ni récursion.
+// runs[k] contient une suite triée de 2^k nœuds (compteur binaire): chaque nœud détaché
+// est fusionné avec les suites de même rang, ce qui garde les fusions récentes en cache.
+// Les nœuds sont rechaînés (les données ne bougent pas); 'prev' est reconstruit en une passe.
+static void list_merge_sort(List *list) {
+    if (!list || list->size <= 1) return;
 
-static void draw_node(cairo_t *cr, double x, double y, const char *text, gboolean is_double) {
-    // Boîte principale du nœud (Data)
-    cairo_set_source_rgb(cr, 0.2, 0.2, 0.25); // Dark Node fill
-    cairo_rectangle(cr, x, y, NODE_WIDTH, NODE_HEIGHT);
-    cairo_fill_preserve(cr);
-    cairo_set_source_rgb(cr, 0.0, 0.95, 0.4); // Neon Green Border
-    cairo_set_line_width(cr, 1.5);
-    cairo_stroke(cr);
+    Node *runs[64] = {NULL};
+    int max_rank = 0;
+    Node *current = list->head;
 
-    // Séparateur (Next)
-    cairo_set_source_rgb(cr, 0.4, 0.4, 0.5); // Grey separator
-    cairo_move_to(cr, x + NODE_WIDTH * 0.75, y);
-    cairo_line_to(cr, x + NODE_WIDTH * 0.75, y + NODE_HEIGHT);
-    cairo_stroke(cr);
+    while (current) {
+        Node *carry = current;
+        current = current->next;
+        carry->next = NULL;
 
-    if (is_double) {
-          // Séparateur (Prev)
-        cairo_move_to(cr, x + NODE_WIDTH * 0.25, y);
-        cairo_line_to(cr, x + NODE_WIDTH * 0.25, y + NODE_HEIGHT);
-        cairo_stroke(cr);
+        int rank = 0;
+        for (; rank < 63 && runs[rank]; rank++) {
+            // La suite déjà rangée est plus ancienne: elle passe à gauche
+            carry = list_merge_runs(list, runs[rank], carry);
+            runs[rank] = NULL;
+        }
+        runs[rank] = carry;
+        if (rank > max_rank) max_rank = rank;
     }
 
-    // Texte (Data)
-    cairo_set_source_rgb(cr, 1.0, 1.0, 1.0); // White Text
-    cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_BOLD);
-    cairo_set_font_size(cr, 14);
-    cairo_text_extents_t extents;
-    cairo_text_extents(cr, text, &extents);
+    Node *result = NULL;
+    for (int rank = 0; rank <= max_rank; rank++) {
+        if (runs[rank]) result = result ? list_merge_runs(list, runs[rank], result) : runs[rank];
+    }
 
-    double text_center_x = is_double ? x + NODE_WIDTH / 2.0 : x + NODE_WIDTH * 0.375;
-    double text_center_y = y + NODE_HEIGHT / 2.0;
+    list->head = result;
+    list->cursor = NULL; // Les nœuds ont changé de rang
+    gboolean is_double = (g_strcmp0(list->structure_type, "Liste Double") == 0);
+    Node *prev = NULL;
+    for (Node *node = list->head; node; node = node->next) {
+        if (is_double) node->prev = prev;
+        prev = node;
+    }
+    list->tail = prev;
+}
 
-    cairo_move_to(cr, text_center_x - extents.width / 2.0, text_center_y + extents.height / 2.0);
-    cairo_show_text(cr, text);
+// --- [LISTES] --- Liste Déroulée (blocs de plusieurs éléments) ---
+
+static gboolean list_is_unrolled(const List *list) {
+    return g_strcmp0(list->structure_type, "Liste Déroulée") == 0;
 }
 
-static void draw_arrow(cairo_t *cr, double x1, double y1, double x2, double y2) {
-    cairo_set_source_rgb(cr, 0.8, 0.8, 0.8); // Light arrow
+static ListBlock *unrolled_block_new(const List *list) {
+    ListBlock *block = g_malloc(UNROLLED_BLOCK_BYTES);
+    block->next = NULL;
+    block->prev = NULL;
+    block->count = 0;
+    block->capacity = (guint32)((UNROLLED_BLOCK_BYTES - sizeof(ListBlock)) / list->element_size);
+    return block;
+}
 
-    cairo_set_line_width(cr, 1.5);
-    cairo_move_to(cr, x1, y1);
-    cairo_line_to(cr, x2, y2);
-    cairo_stroke(cr);
+static void unrolled_link_after(List *list, ListBlock *block, ListBlock *new_block) {
+    new_block->prev = block;
+    new_block->next = block ? block->next : list->first_block;
+    if (new_block->next) new_block->next->prev = new_block;
+    else list->last_block = new_block;
+    if (block) block->next = new_block;
+    else list->first_block = new_block;
+    list->block_count++;
+}
 
-    double angle = atan2(y2 - y1, x2 - x1);
-    double head_len = 10;
+static void unrolled_unlink(List *list, ListBlock *block) {
+    if (block->prev) block->prev->next = block->next;
+    else list->first_block = block->next;
+    if (block->next) block->next->prev = block->prev;
+    else list->last_block = block->prev;
+    list->block_count--;
+    g_free(block);
+}
 
-    cairo_move_to(cr, x2, y2);
-    cairo_line_to(cr,
-                     x2 - head_len * cos(angle - M_PI / 6),
-                     y2 - head_len * sin(angle - M_PI / 6));
-    cairo_move_to(cr, x2, y2);
-    cairo_line_to(cr,
-                     x2 - head_len * cos(angle + M_PI / 6),
-                     y2 - head_len * sin(angle + M_PI / 6));
-    cairo_stroke(cr);
+// Bloc contenant l'élément 'index' (parcours depuis l'extrémité la plus proche, bloc par bloc).
+// Pour index == size, retourne le dernier bloc avec *offset = count.
+static ListBlock *unrolled_locate(List *list, size_t index, size_t *offset) {
+    if (index >= list->size) {
+        *offset = list->last_block ? list->last_block->count : 0;
+        return list->last_block;
+    }
+    if (index < list->size / 2) {
+        ListBlock *block = list->first_block;
+        while (index >= block->count) {
+            index -= block->count;
+            block = block->next;
+        }
+        *offset = index;
+        return block;
+    }
+    size_t remaining = list->size - index; // Éléments depuis la fin, élément compris
+    ListBlock *block = list->last_block;
+    while (remaining > block->count) {
+        remaining -= block->count;
+        block = block->prev;
+    }
+    *offset = block->count - remaining;
+    return block;
 }
 
-// Fonction pour dessiner un nœud spécial (Tête ou NULL)
-static void draw_special_node(cairo_t *cr, double x, double y, const char *text, gboolean is_head) {
-    // Style différent pour Tête (bleu) et NULL (rouge)
-    if (is_head) {
-        // Tête - Style bleu
-        cairo_set_source_rgb(cr, 0.1, 0.3, 0.6); // Dark Blue fill
-        cairo_rectangle(cr, x, y, NODE_WIDTH, NODE_HEIGHT);
-        cairo_fill_preserve(cr);
-        cairo_set_source_rgb(cr, 0.2, 0.6, 1.0); // Light Blue Border
-    } else {
-        // NULL - Style rouge/gris
-        cairo_set_source_rgb(cr, 0.3, 0.1, 0.1); // Dark Red fill
-        cairo_rectangle(cr, x, y, NODE_WIDTH, NODE_HEIGHT);
-        cairo_fill_preserve(cr);
-        cairo_set_source_rgb(cr, 1.0, 0.3, 0.3); // Red Border
+static void *unrolled_value_at(List *list, size_t index) {
+    if (index >= list->size) return NULL;
+    size_t offset;
+    ListBlock *block = unrolled_locate(list, index, &offset);
+    return block->items + offset * list->element_size;
+}
+
+static void unrolled_insert(List *list, const void *value, size_t index) {
+    size_t es = list->element_size;
+    size_t offset;
+    ListBlock *block = unrolled_locate(list, index, &offset);
+
+    if (!block) {
+        block = unrolled_block_new(list);
+        unrolled_link_after(list, NULL, block);
+        offset = 0;
     }
-    cairo_set_line_width(cr, 2.0);
-    cairo_stroke(cr);
 
-    // Texte
-    cairo_set_source_rgb(cr, 1.0, 1.0, 1.0); // White Text
-    cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_BOLD);
-    cairo_set_font_size(cr, 14);
-    cairo_text_extents_t extents;
-    cairo_text_extents(cr, text, &extents);
+    if (block->count == block->capacity) {
+        // Ajout en fin sur un bloc plein: nouveau bloc vide (les blocs restent pleins)
+        if (offset == block->count && block == list->last_block) {
+            ListBlock *new_block = unrolled_block_new(list);
+            unrolled_link_after(list, block, new_block);
+            block = new_block;
+            offset = 0;
+        } else {
+            // Scission: la moitié haute part dans un nouveau bloc
+            ListBlock *new_block = unrolled_block_new(list);
+            guint32 keep = block->count / 2;
+            new_block->count = block->count - keep;
+            memcpy(new_block->items, block->items + keep * es, new_block->count * es);
+            block->count = keep;
+            unrolled_link_after(list, block, new_block);
+            if (offset > keep) {
+                block = new_block;
+                offset -= keep;
+            }
+        }
+    }
 
-    double text_center_x = x + NODE_WIDTH / 2.0;
-    double text_center_y = y + NODE_HEIGHT / 2.0;
+    unsigned char *slot = block->items + offset * es;
+    memmove(slot + es, slot, (block->count - offset) * es);
+    if (g_strcmp0(list->element_type, "Chaîne de Caractères") == 0) {
+        char *copy = g_strdup(*(const char **)value);
+        memcpy(slot, &copy, sizeof(char *));
+    } else {
+        memcpy(slot, value, es);
+    }
+    block->count++;
+    list->size++;
+    list_hash_add(list, slot);
+}
 
-    cairo_move_to(cr, text_center_x - extents.width / 2.0, text_center_y + extents.height / 2.0);
-    cairo_show_text(cr, text);
+static void unrolled_delete(List *list, size_t index) {
+    size_t es = list->element_size;
+    size_t offset;
+    ListBlock *block = unrolled_locate(list, index, &offset);
+    unsigned char *slot = block->items + offset * es;
+
+    list_hash_remove(list, slot);
+    if (g_strcmp0(list->element_type, "Chaîne de Caractères") == 0) {
+        g_free(*(char **)slot);
+    }
+    memmove(slot, slot + es, (block->count - offset - 1) * es);
+    block->count--;
+    list->size--;
+
+    if (block->count == 0) {
+        unrolled_unlink(list, block);
+    } else if (block->count < block->capacity / 2) {
+        // Bloc à moins de moitié plein: fusion avec un voisin si l'ensemble tient dans un bloc
+        if (block->next && block->count + block->next->count <= block->capacity) {
+            ListBlock *next = block->next;
+            memcpy(block->items + block->count * es, next->items, next->count * es);
+            block->count += next->count;
+            unrolled_unlink(list, next);
+        } else if (block->prev && block->count + block->prev->count <= block->capacity) {
+            ListBlock *prev = block->prev;
+            memcpy(prev->items + prev->count * es, block->items, block->count * es);
+            prev->count += block->count;
+            unrolled_unlink(list, block);
+        }
+    }
+}
+
+static void unrolled_free(List *list) {
+    gboolean is_string = g_strcmp0(list->element_type, "Chaîne de Caractères") == 0;
+    ListBlock *block = list->first_block;
+    while (block) {
+        ListBlock *next = block->next;
+        if (is_string) {
+            for (guint32 i = 0; i < block->count; i++) g_free(((char **)block->items)[i]);
+        }
+        g_free(block);
+        block = next;
+    }
+    list->first_block = NULL;
+    list->last_block = NULL;
+    list->block_count = 0;
+}
+
+// Tri fusion ascendant stable sur un tableau contigu (tampon auxiliaire de même taille)
+static void merge_sort_contiguous(void *data, size_t n, size_t es, int (*compare_func)(const void *, const void *)) {
+    unsigned char *buffer = g_malloc(n * es);
+    unsigned char *src = data, *dst = buffer;
+
+    for (size_t width = 1; width < n; width *= 2) {
+        for (size_t lo = 0; lo < n; lo += 2 * width) {
+            size_t mid = MIN(lo + width, n), hi = MIN(lo + 2 * width, n);
+            size_t i = lo, j = mid, k = lo;
+            while (i < mid && j < hi) {
+                if (compare_func(src + j * es, src + i * es) < 0) memcpy(dst + (k++) * es, src + (j++) * es, es);
+                else memcpy(dst + (k++) * es, src + (i++) * es, es);
+            }
+            memcpy(dst + k * es, src + i * es, (mid - i) * es);
+            k += mid - i;
+            memcpy(dst + k * es, src + j * es, (hi - j) * es);
+        }
+        unsigned char *swap = src;
+        src = dst;
+        dst = swap;
+    }
+    if (src != data) memcpy(data, src, n * es);
+    g_free(buffer);
 }
 
-static gboolean draw_list_callback(GtkWidget *widget, cairo_t *cr, gpointer data) {
-    AppData *app_data = (AppData *)data;
-    List *list = app_data->current_list;
-    guint width = gtk_widget_get_allocated_width(widget);
-    guint height = gtk_widget_get_allocated_height(widget);
+// Tri d'une liste déroulée: les blocs sont déjà presque un tableau, on rassemble les éléments,
+// on applique le noyau du module Tableaux (ou le tri fusion stable), puis on les redistribue
+// dans les mêmes blocs. sort_func == NULL sélectionne le tri fusion.
+static void unrolled_sort(List *list, SortFunction sort_func) {
+    if (list->size <= 1) return;
+    size_t es = list->element_size;
+    unsigned char *buffer = g_malloc(list->size * es);
 
-    cairo_set_source_rgb(cr, 0.1, 0.1, 0.12); // Dark BG
-    cairo_paint(cr);
-    cairo_set_source_rgb(cr, 1.0, 1.0, 1.0); // White text/lines
+    size_t pos = 0;
+    for (ListBlock *block = list->first_block; block; block = block->next) {
+        memcpy(buffer + pos * es, block->items, block->count * es);
+        pos += block->count;
+    }
 
-    if (!list || !list->head) {
-        cairo_set_source_rgb(cr, 1.0, 1.0, 1.0); // White text/lines
-        cairo_move_to(cr, width / 2.0 - 50, height / 2.0);
-        cairo_show_text(cr, "Liste Vide");
-        return TRUE;
+    if (sort_func) sort_func(buffer, list->size, es, list->compare_func);
+    else merge_sort_contiguous(buffer, list->size, es, list->compare_func);
+
+    pos = 0;
+    for (ListBlock *block = list->first_block; block; block = block->next) {
+        memcpy(block->items, buffer + pos * es, block->count * es);
+        pos += block->count;
     }
+    g_free(buffer);
+}
 
-    gboolean is_double = g_strcmp0(list->structure_type, "Liste Double") == 0;
-    Node *current = list->head;
-    int i = 0;
 
-    // Dessiner "Tête" au début
-    double head_x = 10;
-    double y = height / 2.0 - NODE_HEIGHT / 2.0;
-    draw_special_node(cr, head_x, y, "Tête", TRUE);
+// --- [LISTES] --- Liste à Sauts indexable (triée par valeur) ---
 
-    // Flèche de Tête vers le premier nœud
-    double first_node_x = head_x + NODE_WIDTH + SPACING;
-    double arrow_start_x = head_x + NODE_WIDTH;
-    double arrow_end_x = first_node_x;
-    draw_arrow(cr, arrow_start_x, y + NODE_HEIGHT/2.0, arrow_end_x, y + NODE_HEIGHT/2.0);
+static gboolean list_is_skip(const List *list) {
+    return g_strcmp0(list->structure_type, "Liste à Sauts") == 0;
+}
 
-    // Décaler l'index pour les nœuds de données
-    i = 1;
+static SkipNode *skip_node_new(int level) {
+    SkipNode *node = g_malloc0(sizeof(SkipNode) + level * sizeof(SkipLink));
+    node->level = level;
+    return node;
+}
 
-    while (current != NULL) {
-        double x = 10 + i * (NODE_WIDTH + SPACING);
-        double node_y = height / 2.0 - NODE_HEIGHT / 2.0;
+// Hauteur aléatoire: probabilité 1/2 de monter d'un niveau
+static int skip_random_level(void) {
+    int level = 1;
+    while (level < SKIP_MAX_LEVEL && (rand() & 1)) level++;
+    return level;
+}
 
-        gchar node_text[64];
-        if (g_strcmp0(list->element_type, "Entiers (Int)") == 0) {
-            g_snprintf(node_text, 64, "%d", *(int *)current->data);
-        } else if (g_strcmp0(list->element_type, "Réels (Float)") == 0) {
-            g_snprintf(node_text, 64, "%.2f", *(float *)current->data);
-        } else if (g_strcmp0(list->element_type, "Caractères (Char)") == 0) {
-            g_snprintf(node_text, 64, "%c", *(char *)current->data);
-        } else if (g_strcmp0(list->element_type, "Chaîne de Caractères") == 0) {
-            const char *str = *(const char **)current->data;
-            if (str) {
-                g_snprintf(node_text, 64, "%.15s", str); // Limiter à 15 caractères pour l'affichage
-            } else {
-                g_snprintf(node_text, 64, "(null)");
-            }
-        } else {
-            g_snprintf(node_text, 64, "Data");
+static void skip_insert(List *list, const void *value) {
+    if (!list->skip_head) {
+        list->skip_head = skip_node_new(SKIP_MAX_LEVEL);
+        list->skip_level = 1;
+    }
+
+    SkipNode *update[SKIP_MAX_LEVEL];
+    size_t rank[SKIP_MAX_LEVEL]; // Rang (nombre de nœuds) atteint à chaque niveau
+    SkipNode *x = list->skip_head;
+    for (int i = list->skip_level - 1; i >= 0; i--) {
+        rank[i] = (i == list->skip_level - 1) ? 0 : rank[i + 1];
+        // Les doublons sont placés après les valeurs égales (ordre d'insertion conservé)
+        while (x->links[i].next && list->compare_func(&x->links[i].next->payload, value) <= 0) {
+            rank[i] += x->links[i].width;
+            x = x->links[i].next;
         }
+        update[i] = x;
+    }
 
-        draw_node(cr, x, node_y, node_text, is_double);
+    int level = skip_random_level();
+    if (level > list->skip_level) {
+        for (int i = list->skip_level; i < level; i++) {
+            rank[i] = 0;
+            update[i] = list->skip_head;
+            update[i]->links[i].width = list->size;
+        }
+        list->skip_level = level;
+    }
 
-        // Flèche Next vers le nœud suivant ou NULL
-        if (current->next != NULL) {
-            double arrow_start_x = x + NODE_WIDTH * 0.75;
-            double arrow_end_x = x + NODE_WIDTH + SPACING;
-            draw_arrow(cr, arrow_start_x, node_y + NODE_HEIGHT/2.0, arrow_end_x, node_y + NODE_HEIGHT/2.0);
-        } else {
-            // Flèche vers NULL (dernier nœud)
-            double arrow_start_x = x + NODE_WIDTH * 0.75;
-            double null_x = x + NODE_WIDTH + SPACING;
-            double arrow_end_x = null_x;
-            draw_arrow(cr, arrow_start_x, node_y + NODE_HEIGHT/2.0, arrow_end_x, node_y + NODE_HEIGHT/2.0);
+    SkipNode *node = skip_node_new(level);
+    if (g_strcmp0(list->element_type, "Chaîne de Caractères") == 0) {
+        node->payload.s = g_strdup(*(const char **)value);
+    } else {
+        memcpy(&node->payload, value, list->element_size);
+    }
+
+    for (int i = 0; i < level; i++) {
+        node->links[i].next = update[i]->links[i].next;
+        node->links[i].width = update[i]->links[i].width - (rank[0] - rank[i]);
+        update[i]->links[i].next = node;
+        update[i]->links[i].width = rank[0] - rank[i] + 1;
+    }
+    // Les liens des niveaux supérieurs enjambent désormais un nœud de plus
+    for (int i = level; i < list->skip_level; i++) {
+        update[i]->links[i].width++;
+    }
+    list->size++;
+}
 
-            // Dessiner "NULL" après le dernier nœud
-            draw_special_node(cr, null_x, node_y, "NULL", FALSE);
+// Nœud de rang 'index' (0 = premier) en O(log n) espéré
+static SkipNode *skip_at(List *list, size_t index) {
+    if (!list->skip_head || index >= list->size) return NULL;
+    size_t remaining = index + 1;
+    SkipNode *x = list->skip_head;
+    for (int i = list->skip_level - 1; i >= 0; i--) {
+        while (x->links[i].next && x->links[i].width <= remaining) {
+            remaining -= x->links[i].width;
+            x = x->links[i].next;
         }
+        if (remaining == 0) break;
+    }
+    return x;
+}
 
-        // Flèche Prev pour les listes doubles
-        if (is_double && current->prev != NULL) {
-             double arrow_start_x = x + NODE_WIDTH * 0.25;
-             double arrow_end_x = x - SPACING;
-             draw_arrow(cr, arrow_start_x, node_y + NODE_HEIGHT * 0.75, arrow_end_x, node_y + NODE_HEIGHT * 0.75);
+static void skip_delete(List *list, size_t index) {
+    if (!list->skip_head || index >= list->size) return;
+
+    SkipNode *update[SKIP_MAX_LEVEL];
+    size_t traversed = 0;
+    SkipNode *x = list->skip_head;
+    for (int i = list->skip_level - 1; i >= 0; i--) {
+        while (x->links[i].next && traversed + x->links[i].width <= index) {
+            traversed += x->links[i].width;
+            x = x->links[i].next;
         }
+        update[i] = x;
+    }
 
-        current = current->next;
-        i++;
+    SkipNode *node = update[0]->links[0].next;
+    for (int i = 0; i < list->skip_level; i++) {
+        if (update[i]->links[i].next == node) {
+            update[i]->links[i].width += node->links[i].width - 1;
+            update[i]->links[i].next = node->links[i].next;
+        } else {
+            update[i]->links[i].width--;
+        }
+    }
+    while (list->skip_level > 1 && !list->skip_head->links[list->skip_level - 1].next) {
+        list->skip_level--;
     }
 
-    return TRUE;
+    if (g_strcmp0(list->element_type, "Chaîne de Caractères") == 0) g_free(node->payload.s);
+    g_free(node);
+    list->size--;
 }
 
-static void update_list_drawing_area_size(AppData *app_data) {
-    if (!app_data->current_list || !app_data->list_drawing_area) return;
-    int n = app_data->current_list->size;
-    // Calculer la largeur nécessaire : Tête + n nœuds de données + NULL + espacement
-    // Tête (1) + n nœuds + NULL (1) = n + 2 nœuds au total
-    // Position de départ (10) + Tête (NODE_WIDTH) + SPACING + n nœuds * (NODE_WIDTH + SPACING) + NULL (NODE_WIDTH) + marge (50)
-    int width = 10 + NODE_WIDTH + SPACING + n * (NODE_WIDTH + SPACING) + NODE_WIDTH + 50;
-    if (width < 600) width = 600; // Minimum width
-    gtk_widget_set_size_request(app_data->list_drawing_area, width, 400);
-    gtk_widget_queue_draw(app_data->list_drawing_area);
+static gboolean skip_contains(List *list, const void *value) {
+    if (!list->skip_head) return FALSE;
+    SkipNode *x = list->skip_head;
+    for (int i = list->skip_level - 1; i >= 0; i--) {
+        while (x->links[i].next && list->compare_func(&x->links[i].next->payload, value) < 0) {
+            x = x->links[i].next;
+        }
+    }
+    x = x->links[0].next;
+    return x && list->compare_func(&x->payload, value) == 0;
 }
 
+static void skip_free(List *list) {
+    if (!list->skip_head) return;
+    gboolean is_string = g_strcmp0(list->element_type, "Chaîne de Caractères") == 0;
+    SkipNode *node = list->skip_head->links[0].next;
+    while (node) {
+        SkipNode *next = node->links[0].next;
+        if (is_string) g_free(node->payload.s);
+        g_free(node);
+        node = next;
+    }
+    g_free(list->skip_head);
+    list->skip_head = NULL;
+    list->skip_level = 0;
+}
 
-// --- [LISTES] --- Fonctions de Callback (TP2) ---
-
-static void on_list_create_clicked(GtkWidget *widget, gpointer data) {
-    AppData *app_data = (AppData *)data;
-    const gchar *structure_type = gtk_combo_box_text_get_active_text(GTK_COMBO_BOX_TEXT(app_data->list_type_combo));
-    const gchar *element_type = gtk_combo_box_text_get_active_text(GTK_COMBO_BOX_TEXT(app_data->type_combo));
+// Pointeur vers la valeur à l'index donné, quel que soit le type de liste
+static void *list_value_at(List *list, int index) {
+    if (index < 0 || (size_t)index >= list->size) return NULL;
+    if (list_is_unrolled(list)) return unrolled_value_at(list, (size_t)index);
+    if (list_is_skip(list)) return &skip_at(list, (size_t)index)->payload;
+    Node *node = get_node_at(list, index);
+    return node ? node->data : NULL;
+}
 
-    if (app_data->current_list) list_free(app_data->current_list);
-    app_data->current_list = list_new(structure_type, element_type);
 
-    GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
-    gtk_text_buffer_set_text(buffer, g_strdup_printf("Liste créée:\nType: %s\nÉléments: %s\nTaille: 0. Cliquez sur Remplir ou Insérer.",
-                                                     structure_type, element_type), -1);
+// --- [LISTES] --- Opérations groupées (construction, greffe, scission, suppression de plage) ---
 
-    gtk_widget_queue_draw(app_data->list_drawing_area);
-    update_list_drawing_area_size(app_data);
+// Copie d'une valeur dans l'emplacement d'un élément (les chaînes sont dupliquées)
+static void list_store_value(const List *list, void *slot, const void *value) {
+    if (g_strcmp0(list->element_type, "Chaîne de Caractères") == 0) {
+        char *copy = g_strdup(*(char *const *)value);
+        memcpy(slot, &copy, sizeof(char *));
+    } else {
+        memcpy(slot, value, list->element_size);
+    }
 }
 
-// Legacy callbacks removed (on_list_insert_clicked, on_list_delete_clicked)
-static void on_list_input_source_toggled(GtkWidget *widget, gpointer data) {
-    AppData *app_data = (AppData *)data;
-    if (gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(widget))) {
-        const gchar *label = gtk_button_get_label(GTK_BUTTON(widget));
-        if (g_strcmp0(label, "Aléatoire") == 0) {
-            app_data->list_input_source = 0;
-            gtk_widget_show(app_data->list_random_box);
-            gtk_widget_hide(app_data->list_manual_box);
-        } else if (g_strcmp0(label, "Manuelle") == 0) {
-            app_data->list_input_source = 1;
-            gtk_widget_hide(app_data->list_random_box);
-            gtk_widget_show(app_data->list_manual_box);
+// Ajoute 'count' valeurs contiguës (tableau d'éléments de element_size octets) en fin de liste.
+// Listes simples/doubles: un seul slab réservé pour tout le lot et un seul passage de chaînage.
+static void list_build_from_array(List *list, const void *values, size_t count) {
+    if (!list || !values || count == 0) return;
+    size_t es = list->element_size;
+    const unsigned char *src = values;
+
+    if (list_is_skip(list)) {
+        // La position de chaque valeur dépend de l'ordre: insertions successives en O(log n)
+        for (size_t i = 0; i < count; i++) skip_insert(list, src + i * es);
+        return;
+    }
+    if (list_is_unrolled(list)) {
+        // Remplissage direct des blocs, sans recherche de position
+        list_hash_reserve(list, count);
+        ListBlock *block = list->last_block;
+        for (size_t i = 0; i < count; i++) {
+            if (!block || block->count == block->capacity) {
+                block = unrolled_block_new(list);
+                unrolled_link_after(list, list->last_block, block);
+            }
+            unsigned char *slot = block->items + block->count * es;
+            list_store_value(list, slot, src + i * es);
+            block->count++;
+            list_hash_add(list, slot);
         }
+        list->size += count;
+        return;
     }
-}
 
-static void on_list_fill_random_clicked(GtkWidget *widget, gpointer data) {
-    AppData *app_data = (AppData *)data;
-    if (!app_data->current_list) on_list_create_clicked(NULL, app_data);
-    if (!app_data->current_list) return;
-    int size = gtk_spin_button_get_value_as_int(app_data->list_size_input);
-    if (size <= 0) return;
+    list_hash_reserve(list, count);
+    gboolean is_double = g_strcmp0(list->structure_type, "Liste Double") == 0;
+    Node *nodes = node_pool_alloc_batch(list->pool, count);
+    memset(nodes, 0, count * sizeof(Node));
+    for (size_t i = 0; i < count; i++) {
+        Node *node = &nodes[i];
+        node->data = &node->payload;
+        list_store_value(list, node->data, src + i * es);
+        node->next = (i + 1 < count) ? &nodes[i + 1] : NULL;
+        if (is_double) node->prev = i ? &nodes[i - 1] : list->tail;
+        list_hash_add(list, node->data);
+    }
+    if (list->tail) list->tail->next = nodes;
+    else list->head = nodes;
+    list->tail = &nodes[count - 1];
+    list->size += count;
+}
+
+// Scinde un bloc: les éléments [offset, count) passent dans un nouveau bloc chaîné juste après
+static ListBlock *unrolled_split_block(List *list, ListBlock *block, size_t offset) {
+    size_t es = list->element_size;
+    ListBlock *new_block = unrolled_block_new(list);
+    new_block->count = block->count - (guint32)offset;
+    memcpy(new_block->items, block->items + offset * es, new_block->count * es);
+    block->count = (guint32)offset;
+    unrolled_link_after(list, block, new_block);
+    return new_block;
+}
+
+// Vide une liste dont les éléments ont été transférés ailleurs (sans les libérer)
+static void list_reset_moved(List *list) {
+    list->head = NULL;
+    list->tail = NULL;
+    list->cursor = NULL;
+    list->size = 0;
+    list->first_block = NULL;
+    list->last_block = NULL;
+    list->block_count = 0;
+    list_hash_clear(list);
+    list->value_set_stale = FALSE;
+}
+
+// Greffe tous les éléments de 'src' dans 'dst' à la position 'index' (index >= taille: en fin).
+// Listes simples/doubles et déroulées: O(1) une fois le point de greffe atteint, les nœuds
+// ne sont ni copiés ni réalloués. 'src' est vidé. Retourne FALSE si les listes sont incompatibles.
+static gboolean list_splice(List *dst, int index, List *src) {
+    if (!dst || !src || dst == src) return FALSE;
+    if (g_strcmp0(dst->structure_type, src->structure_type) != 0 ||
+        g_strcmp0(dst->element_type, src->element_type) != 0) return FALSE;
+    if (src->size == 0) return TRUE;
+    if (index < 0 || (size_t)index > dst->size) index = dst->size;
+
+    if (list_is_skip(dst)) {
+        // L'ordre des valeurs impose la position: fusion élément par élément
+        for (SkipNode *node = src->skip_head->links[0].next; node; node = node->links[0].next) {
+            skip_insert(dst, &node->payload);
+        }
+        skip_free(src);
+        src->size = 0;
+        return TRUE;
+    }
 
-    const gchar *element_type = app_data->current_list->element_type;
-    int added_count = 0;
-    int max_attempts = 1000; // Limite pour éviter les boucles infinies
+    if (list_is_unrolled(dst)) {
+        ListBlock *before; // Bloc après lequel greffer (NULL: en tête)
+        if ((size_t)index == dst->size) {
+            before = dst->last_block;
+        } else {
+            size_t offset;
+            ListBlock *block = unrolled_locate(dst, (size_t)index, &offset);
+            if (offset > 0) unrolled_split_block(dst, block, offset);
+            before = (offset > 0) ? block : block->prev;
+        }
+        ListBlock *after = before ? before->next : dst->first_block;
+        src->first_block->prev = before;
+        src->last_block->next = after;
+        if (before) before->next = src->first_block;
+        else dst->first_block = src->first_block;
+        if (after) after->prev = src->last_block;
+        else dst->last_block = src->last_block;
+        dst->block_count += src->block_count;
+    } else {
+        gboolean is_double = g_strcmp0(dst->structure_type, "Liste Double") == 0;
+        if (dst->pool != src->pool) {
+            if (src->pool->ref_count == 1) {
+                // Les slabs de src rejoignent le pool de dst: les nœuds restent en place
+                node_pool_absorb(dst->pool, src->pool);
+                src->pool = node_pool_new();
+            } else {
+                // Pool de src partagé avec une autre liste: les nœuds sont recopiés dans celui de dst
+                // (les chaînes changent de propriétaire sans être dupliquées)
+                Node *first = NULL, *last = NULL;
+                for (Node *node = src->head; node; node = node->next) {
+                    Node *copy = node_pool_alloc(dst->pool);
+                    copy->payload = node->payload;
+                    if (is_double) copy->prev = last;
+                    if (last) last->next = copy;
+                    else first = copy;
+                    last = copy;
+                }
+                node_pool_free_chain(src->pool, src->head, src->tail);
+                src->head = first;
+                src->tail = last;
+            }
+        }
 
-    for(int i=0; i<size; i++) {
-        int attempts = 0;
-        gboolean value_added = FALSE;
+        Node *first = src->head, *last = src->tail;
+        if (index == 0) {
+            last->next = dst->head;
+            if (dst->head && is_double) dst->head->prev = last;
+            dst->head = first;
+            if (!dst->tail) dst->tail = last;
+        } else {
+            Node *prev = ((size_t)index == dst->size) ? dst->tail : get_node_at(dst, index - 1);
+            last->next = prev->next;
+            if (is_double) {
+                first->prev = prev;
+                if (prev->next) prev->next->prev = last;
+            }
+            prev->next = first;
+            if (prev == dst->tail) dst->tail = last;
+        }
+        if (dst->cursor && dst->cursor_index >= index) dst->cursor_index += (int)src->size;
+    }
 
-        while (!value_added && attempts < max_attempts) {
-            attempts++;
+    dst->size += src->size;
+    list_hash_invalidate(dst);
+    list_reset_moved(src);
+    return TRUE;
+}
 
-            if (g_strcmp0(element_type, "Entiers (Int)") == 0) {
-                int val = rand() % 10000; // Augmenter la plage pour éviter les collisions
-                // Vérifier si la valeur existe déjà
-                if (!list_contains_value(app_data->current_list, &val)) {
+static gboolean list_concat(List *dst, List *src) {
+    return list_splice(dst, dst ? (int)dst->size : 0, src);
+}
+
+// Détache les éléments [index, taille) dans une nouvelle liste de même type.
+// Listes simples/doubles: un seul parcours jusqu'à index-1, les nœuds restent dans les slabs
+// d'origine (pool partagé par comptage de références).
+static List *list_split(List *list, int index) {
+    List *tail_list = list_new(list->structure_type, list->element_type);
+    if (index < 0) index = 0;
+    if ((size_t)index >= list->size) return tail_list;
+    size_t moved = list->size - (size_t)index;
+
+    if (list_is_skip(list)) {
+        for (SkipNode *node = skip_at(list, (size_t)index); node; node = node->links[0].next) {
+            skip_insert(tail_list, &node->payload);
+        }
+        for (size_t i = 0; i < moved; i++) skip_delete(list, (size_t)index);
+        return tail_list;
+    }
+
+    if (list_is_unrolled(list)) {
+        size_t offset;
+        ListBlock *block = unrolled_locate(list, (size_t)index, &offset);
+        if (offset > 0) block = unrolled_split_block(list, block, offset);
+        ListBlock *prev = block->prev;
+        tail_list->first_block = block;
+        tail_list->last_block = list->last_block;
+        block->prev = NULL;
+        if (prev) prev->next = NULL;
+        else list->first_block = NULL;
+        list->last_block = prev;
+        for (ListBlock *b = block; b; b = b->next) tail_list->block_count++;
+        list->block_count -= tail_list->block_count;
+    } else {
+        node_pool_release(tail_list->pool);
+        tail_list->pool = list->pool;
+        list->pool->ref_count++;
+
+        Node *prev = index ? get_node_at(list, index - 1) : NULL;
+        Node *first = prev ? prev->next : list->head;
+        tail_list->head = first;
+        tail_list->tail = list->tail;
+        first->prev = NULL;
+        if (prev) prev->next = NULL;
+        else list->head = NULL;
+        list->tail = prev;
+        if (list->cursor && list->cursor_index >= index) list->cursor = NULL;
+    }
+
+    list->size = (size_t)index;
+    tail_list->size = moved;
+    list_hash_invalidate(list);
+    list_hash_invalidate(tail_list);
+    return tail_list;
+}
+
+// Supprime 'count' éléments à partir de 'start' en un seul parcours.
+// Listes simples/doubles: la chaîne détachée rejoint la liste libre du pool d'un bloc.
+static void list_delete_range(List *list, int start, int count) {
+    if (!list || start < 0 || (size_t)start >= list->size || count <= 0) return;
+    count = (int)MIN((size_t)count, list->size - (size_t)start);
+    gboolean is_string = g_strcmp0(list->element_type, "Chaîne de Caractères") == 0;
+
+    if (list_is_skip(list)) {
+        for (int i = 0; i < count; i++) skip_delete(list, (size_t)start);
+        return;
+    }
+
+    if (list_is_unrolled(list)) {
+        size_t es = list->element_size;
+        size_t offset;
+        ListBlock *block = unrolled_locate(list, (size_t)start, &offset);
+        ListBlock *left = (offset > 0) ? block : block->prev; // Bloc qui borde la plage à gauche
+        size_t remaining = (size_t)count;
+        while (remaining > 0) {
+            size_t take = MIN(remaining, block->count - offset);
+            unsigned char *slot = block->items + offset * es;
+            for (size_t j = 0; j < take; j++) {
+                list_hash_remove(list, slot + j * es);
+                if (is_string) g_free(((char **)slot)[j]);
+            }
+            memmove(slot, slot + take * es, (block->count - offset - take) * es);
+            block->count -= (guint32)take;
+            remaining -= take;
+            ListBlock *next = block->next;
+            if (block->count == 0) unrolled_unlink(list, block);
+            block = next;
+            offset = 0;
+        }
+        // Les deux blocs qui bordent la plage fusionnent s'ils tiennent dans un seul
+        if (left && left->next && left->count + left->next->count <= left->capacity) {
+            ListBlock *next = left->next;
+            memcpy(left->items + left->count * es, next->items, next->count * es);
+            left->count += next->count;
+            unrolled_unlink(list, next);
+        }
+        list->size -= (size_t)count;
+        return;
+    }
+
+    gboolean is_double = g_strcmp0(list->structure_type, "Liste Double") == 0;
+    Node *prev = start ? get_node_at(list, start - 1) : NULL;
+    Node *first = prev ? prev->next : list->head;
+    Node *last = first;
+    for (int i = 0; ; i++) {
+        list_hash_remove(list, last->data);
+        if (is_string) g_free(last->payload.s);
+        if (i == count - 1) break;
+        last = last->next;
+    }
+    Node *after = last->next;
+    if (prev) prev->next = after;
+    else list->head = after;
+    if (after) {
+        if (is_double) after->prev = prev;
+    } else {
+        list->tail = prev;
+    }
+    node_pool_free_chain(list->pool, first, last);
+
+    if (list->cursor && list->cursor_index >= start) {
+        if (list->cursor_index < start + count) list->cursor = NULL;
+        else list->cursor_index -= count;
+    }
+    list->size -= (size_t)count;
+}
+
+
+// --- [LISTES] --- Historique d'annulation (journal des opérations inverses) ---
+
+// Insère 'count' valeurs à la position 'index' (construction groupée puis greffe)
+static void list_insert_array(List *list, int index, const void *values, size_t count) {
+    if (count == 0) return;
+    if (list_is_skip(list) || (size_t)index >= list->size) {
+        list_build_from_array(list, values, count);
+        return;
+    }
+    List *chunk = list_new(list->structure_type, list->element_type);
+    list_build_from_array(chunk, values, count);
+    list_splice(list, index, chunk);
+    list_free(chunk);
+}
+
+// Rang de la première valeur >= value dans une liste à sauts
+static size_t skip_rank(List *list, const void *value) {
+    size_t rank = 0;
+    SkipNode *x = list->skip_head;
+    for (int i = list->skip_level - 1; i >= 0; i--) {
+        while (x->links[i].next && list->compare_func(&x->links[i].next->payload, value) < 0) {
+            rank += x->links[i].width;
+            x = x->links[i].next;
+        }
+    }
+    return rank;
+}
+
+// Copie des valeurs [index, index + count) (chaînes dupliquées)
+static unsigned char *list_copy_range(List *list, int index, size_t count) {
+    size_t es = list->element_size;
+    gboolean is_string = g_strcmp0(list->element_type, "Chaîne de Caractères") == 0;
+    unsigned char *values = g_malloc(MAX(count, 1) * es);
+    size_t pos = 0;
+    if (list_is_unrolled(list)) {
+        size_t offset;
+        ListBlock *block = count ? unrolled_locate(list, (size_t)index, &offset) : NULL;
+        for (; block && pos < count; block = block->next, offset = 0) {
+            size_t take = MIN(count - pos, block->count - offset);
+            memcpy(values + pos * es, block->items + offset * es, take * es);
+            pos += take;
+        }
+    } else if (list_is_skip(list)) {
+        for (SkipNode *node = skip_at(list, (size_t)index); node && pos < count; node = node->links[0].next) {
+            memcpy(values + (pos++) * es, &node->payload, es);
+        }
+    } else {
+        for (Node *node = get_node_at(list, index); node && pos < count; node = node->next) {
+            memcpy(values + (pos++) * es, node->data, es);
+        }
+    }
+    if (is_string) {
+        for (size_t i = 0; i < pos; i++) ((char **)values)[i] = g_strdup(((char **)values)[i]);
+    }
+    return values;
+}
+
+static void list_values_free(unsigned char *values, size_t count, gboolean owns_strings) {
+    if (values && owns_strings) {
+        for (size_t i = 0; i < count; i++) g_free(((char **)values)[i]);
+    }
+    g_free(values);
+}
+
+static void list_edit_clear(ListEdit *edit) {
+    list_values_free(edit->values, (edit->kind == LIST_EDIT_MODIFY) ? 2 : edit->count, edit->owns_strings);
+    if (edit->list) list_free(edit->list);
+    memset(edit, 0, sizeof(ListEdit));
+}
+
+static void list_history_clear(ListHistory *history) {
+    for (int i = 0; i < history->undo_count; i++) list_edit_clear(&history->undo[i]);
+    for (int i = 0; i < history->redo_count; i++) list_edit_clear(&history->redo[i]);
+    history->undo_count = 0;
+    history->redo_count = 0;
+}
+
+// Nouvelle étape: la branche « rétablir » est abandonnée, l'étape la plus ancienne sort si la pile est pleine
+static ListEdit *list_history_push(ListHistory *history, ListEditKind kind, List *list, int index, size_t count) {
+    for (int i = 0; i < history->redo_count; i++) list_edit_clear(&history->redo[i]);
+    history->redo_count = 0;
+    if (history->undo_count == LIST_HISTORY_DEPTH) {
+        list_edit_clear(&history->undo[0]);
+        memmove(history->undo, history->undo + 1, (LIST_HISTORY_DEPTH - 1) * sizeof(ListEdit));
+        history->undo_count--;
+    }
+    ListEdit *edit = &history->undo[history->undo_count++];
+    memset(edit, 0, sizeof(ListEdit));
+    edit->kind = kind;
+    edit->index = index;
+    edit->count = count;
+    if (list) {
+        edit->element_size = list->element_size;
+        edit->owns_strings = g_strcmp0(list->element_type, "Chaîne de Caractères") == 0;
+    }
+    return edit;
+}
+
+// Après une insertion de 'count' valeurs à 'index'. Listes positionnelles: 'values' est ignoré,
+// la plage sera copiée à la première annulation. Liste à sauts: 'values' est obligatoire
+// (les valeurs insérées sont dispersées selon leur rang).
+static ListEdit *list_history_record_insert(ListHistory *history, List *list, int index, size_t count, const void *values) {
+    if (!history || count == 0) return NULL;
+    ListEdit *edit = list_history_push(history, LIST_EDIT_INSERT, list, index, count);
+    if (values && list_is_skip(list)) {
+        edit->values = g_malloc(count * list->element_size);
+        memcpy(edit->values, values, count * list->element_size);
+        if (edit->owns_strings) {
+            for (size_t i = 0; i < count; i++) ((char **)edit->values)[i] = g_strdup(((char **)edit->values)[i]);
+        }
+    }
+    return edit;
+}
+
+// Avant la suppression de 'count' valeurs à partir de 'index'
+static ListEdit *list_history_record_delete(ListHistory *history, List *list, int index, size_t count) {
+    if (!history || count == 0) return NULL;
+    ListEdit *edit = list_history_push(history, LIST_EDIT_DELETE, list, index, count);
+    edit->values = list_copy_range(list, index, count);
+    return edit;
+}
+
+// Avant le remplacement de la valeur à 'index' par 'new_value'
+static void list_history_record_modify(ListHistory *history, List *list, int index, const void *new_value) {
+    if (!history) return;
+    ListEdit *edit = list_history_push(history, LIST_EDIT_MODIFY, list, index, 1);
+    size_t es = list->element_size;
+    edit->values = g_malloc(2 * es);
+    memcpy(edit->values, list_value_at(list, index), es);
+    memcpy(edit->values + es, new_value, es);
+    if (edit->owns_strings) {
+        for (int i = 0; i < 2; i++) ((char **)edit->values)[i] = g_strdup(((char **)edit->values)[i]);
+    }
+}
+
+// Avant un tri: l'ordre courant est conservé (le tri change toutes les positions)
+static void list_history_record_reorder(ListHistory *history, List *list) {
+    if (!history || list->size < 2) return;
+    ListEdit *edit = list_history_push(history, LIST_EDIT_REORDER, list, 0, list->size);
+    edit->values = list_copy_range(list, 0, list->size);
+}
+
+// Après le remplacement de la liste courante: l'ancienne version (éventuellement NULL) est conservée
+static void list_history_record_replace(ListHistory *history, List *previous) {
+    if (!history) {
+        if (previous) list_free(previous);
+        return;
+    }
+    ListEdit *edit = list_history_push(history, LIST_EDIT_REPLACE, NULL, 0, 0);
+    edit->list = previous;
+}
+
+// Remet la valeur 'from' (actuellement à index) à 'to'
+static void list_edit_set_value(List *list, int index, const void *from, const void *to) {
+    if (list_is_skip(list)) {
+        skip_delete(list, skip_rank(list, from));
+        skip_insert(list, to);
+        return;
+    }
+    void *slot = list_value_at(list, index);
+    list_hash_remove(list, slot);
+    if (g_strcmp0(list->element_type, "Chaîne de Caractères") == 0) g_free(*(char **)slot);
+    list_store_value(list, slot, to);
+    list_hash_add(list, slot);
+}
+
+// Échange position par position les valeurs de la liste et celles du tableau (même multiensemble:
+// l'ensemble de hachage reste valide)
+static void list_edit_swap_order(List *list, unsigned char *values) {
+    size_t es = list->element_size;
+    unsigned char temp[sizeof(NodePayload)];
+    size_t pos = 0;
+    if (list_is_unrolled(list)) {
+        for (ListBlock *block = list->first_block; block; block = block->next) {
+            for (guint32 i = 0; i < block->count; i++, pos++) {
+                memcpy(temp, block->items + i * es, es);
+                memcpy(block->items + i * es, values + pos * es, es);
+                memcpy(values + pos * es, temp, es);
+            }
+        }
+    } else {
+        for (Node *node = list->head; node; node = node->next, pos++) {
+            memcpy(temp, node->data, es);
+            memcpy(node->data, values + pos * es, es);
+            memcpy(values + pos * es, temp, es);
+        }
+    }
+}
+
+static void list_edit_insert_values(List *list, ListEdit *edit) {
+    if (list_is_skip(list)) {
+        for (size_t i = 0; i < edit->count; i++) skip_insert(list, edit->values + i * edit->element_size);
+    } else {
+        list_insert_array(list, edit->index, edit->values, edit->count);
+    }
+}
+
+static void list_edit_remove_values(List *list, ListEdit *edit) {
+    if (list_is_skip(list)) {
+        for (size_t i = 0; i < edit->count; i++) {
+            skip_delete(list, skip_rank(list, edit->values + i * edit->element_size));
+        }
+        return;
+    }
+    if (!edit->values) edit->values = list_copy_range(list, edit->index, edit->count);
+    list_delete_range(list, edit->index, (int)edit->count);
+}
+
+// Liste secondaire reconstituée à partir des valeurs d'une étape de scission ou de greffe
+static List *list_edit_secondary_from_values(List *current, ListEdit *edit) {
+    List *secondary = list_new(current->structure_type, current->element_type);
+    list_build_from_array(secondary, edit->values, edit->count);
+    return secondary;
+}
+
+// Applique l'étape dans un sens ('undo' = annulation) sur la liste courante *current
+// et, pour une scission ou une greffe, sur la liste secondaire *secondary
+static void list_edit_apply(List **current, List **secondary, ListEdit *edit, gboolean undo) {
+    List *list = *current;
+    size_t es = edit->element_size;
+    switch (edit->kind) {
+        case LIST_EDIT_INSERT:
+            if (undo) list_edit_remove_values(list, edit);
+            else list_edit_insert_values(list, edit);
+            break;
+        case LIST_EDIT_DELETE:
+            if (undo) list_edit_insert_values(list, edit);
+            else list_edit_remove_values(list, edit);
+            break;
+        case LIST_EDIT_MODIFY:
+            if (undo) list_edit_set_value(list, edit->index, edit->values + es, edit->values);
+            else list_edit_set_value(list, edit->index, edit->values, edit->values + es);
+            break;
+        case LIST_EDIT_REORDER:
+            list_edit_swap_order(list, edit->values); // L'échange est sa propre inverse
+            break;
+        case LIST_EDIT_REPLACE: {
+            *current = edit->list;
+            edit->list = list;
+            break;
+        }
+    }
+
+    // Scission (suppression) rétablie ou greffe (insertion) annulée: les valeurs retirées forment
+    // la liste secondaire, la précédente est conservée dans l'étape. Sens inverse: elles ont
+    // rejoint la liste courante, la liste secondaire qui les contenait est libérée.
+    if (edit->moves_secondary) {
+        if ((edit->kind == LIST_EDIT_DELETE) != undo) {
+            edit->list = *secondary;
+            *secondary = list_edit_secondary_from_values(list, edit);
+        } else {
+            if (*secondary) list_free(*secondary);
+            *secondary = edit->list;
+            edit->list = NULL;
+        }
+    }
+}
+
+// Déplace une étape de la pile source vers la pile destination en l'appliquant
+static gboolean list_history_step(ListHistory *history, List **current, List **secondary, gboolean undo) {
+    ListEdit *source = undo ? history->undo : history->redo;
+    int *source_count = undo ? &history->undo_count : &history->redo_count;
+    ListEdit *target = undo ? history->redo : history->undo;
+    int *target_count = undo ? &history->redo_count : &history->undo_count;
+    if (*source_count == 0) return FALSE;
+
+    // Vérifier avant de dépiler: en cas de refus, l'édition reste sur sa pile
+    if (source[*source_count - 1].kind != LIST_EDIT_REPLACE && !*current) return FALSE;
+    ListEdit edit = source[--(*source_count)];
+    list_edit_apply(current, secondary, &edit, undo);
+    target[(*target_count)++] = edit; // Les deux piles ont la même capacité: jamais pleine ici
+    return TRUE;
+}
+
+static const char *list_edit_describe(const ListEdit *edit) {
+    switch (edit->kind) {
+        case LIST_EDIT_INSERT: return edit->moves_secondary ? "greffe" : "insertion";
+        case LIST_EDIT_DELETE: return edit->moves_secondary ? "scission" : "suppression";
+        case LIST_EDIT_MODIFY: return "modification";
+        case LIST_EDIT_REORDER: return "tri";
+        default: return "remplacement de la liste";
+    }
+}
+
+
+// --- [LISTES] --- Fonctions de Dessin et Callback (Inchangées) ---
+
+static void draw_node(cairo_t *cr, double x, double y, const char *text, gboolean is_double) {
+    // Boîte principale du nœud (Data)
+    cairo_set_source_rgb(cr, 0.2, 0.2, 0.25); // Dark Node fill
+    cairo_rectangle(cr, x, y, NODE_WIDTH, NODE_HEIGHT);
+    cairo_fill_preserve(cr);
+    cairo_set_source_rgb(cr, 0.0, 0.95, 0.4); // Neon Green Border
+    cairo_set_line_width(cr, 1.5);
+    cairo_stroke(cr);
+
+    // Séparateur (Next)
+    cairo_set_source_rgb(cr, 0.4, 0.4, 0.5); // Grey separator
+    cairo_move_to(cr, x + NODE_WIDTH * 0.75, y);
+    cairo_line_to(cr, x + NODE_WIDTH * 0.75, y + NODE_HEIGHT);
+    cairo_stroke(cr);
+
+    if (is_double) {
+          // Séparateur (Prev)
+        cairo_move_to(cr, x + NODE_WIDTH * 0.25, y);
+        cairo_line_to(cr, x + NODE_WIDTH * 0.25, y + NODE_HEIGHT);
+        cairo_stroke(cr);
+    }
+
+    // Texte (Data)
+    cairo_set_source_rgb(cr, 1.0, 1.0, 1.0); // White Text
+    cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_BOLD);
+    cairo_set_font_size(cr, 14);
+    cairo_text_extents_t extents;
+    cairo_text_extents(cr, text, &extents);
+
+    double text_center_x = is_double ? x + NODE_WIDTH / 2.0 : x + NODE_WIDTH * 0.375;
+    double text_center_y = y + NODE_HEIGHT / 2.0;
+
+    cairo_move_to(cr, text_center_x - extents.width / 2.0, text_center_y + extents.height / 2.0);
+    cairo_show_text(cr, text);
+}
+
+static void draw_arrow(cairo_t *cr, double x1, double y1, double x2, double y2) {
+    cairo_set_source_rgb(cr, 0.8, 0.8, 0.8); // Light arrow
+
+    cairo_set_line_width(cr, 1.5);
+    cairo_move_to(cr, x1, y1);
+    cairo_line_to(cr, x2, y2);
+    cairo_stroke(cr);
+
+    double angle = atan2(y2 - y1, x2 - x1);
+    double head_len = 10;
+
+    cairo_move_to(cr, x2, y2);
+    cairo_line_to(cr,
+                     x2 - head_len * cos(angle - M_PI / 6),
+                     y2 - head_len * sin(angle - M_PI / 6));
+    cairo_move_to(cr, x2, y2);
+    cairo_line_to(cr,
+                     x2 - head_len * cos(angle + M_PI / 6),
+                     y2 - head_len * sin(angle + M_PI / 6));
+    cairo_stroke(cr);
+}
+
+// Fonction pour dessiner un nœud spécial (Tête ou NULL)
+static void draw_special_node(cairo_t *cr, double x, double y, const char *text, gboolean is_head) {
+    // Style différent pour Tête (bleu) et NULL (rouge)
+    if (is_head) {
+        // Tête - Style bleu
+        cairo_set_source_rgb(cr, 0.1, 0.3, 0.6); // Dark Blue fill
+        cairo_rectangle(cr, x, y, NODE_WIDTH, NODE_HEIGHT);
+        cairo_fill_preserve(cr);
+        cairo_set_source_rgb(cr, 0.2, 0.6, 1.0); // Light Blue Border
+    } else {
+        // NULL - Style rouge/gris
+        cairo_set_source_rgb(cr, 0.3, 0.1, 0.1); // Dark Red fill
+        cairo_rectangle(cr, x, y, NODE_WIDTH, NODE_HEIGHT);
+        cairo_fill_preserve(cr);
+        cairo_set_source_rgb(cr, 1.0, 0.3, 0.3); // Red Border
+    }
+    cairo_set_line_width(cr, 2.0);
+    cairo_stroke(cr);
+
+    // Texte
+    cairo_set_source_rgb(cr, 1.0, 1.0, 1.0); // White Text
+    cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_BOLD);
+    cairo_set_font_size(cr, 14);
+    cairo_text_extents_t extents;
+    cairo_text_extents(cr, text, &extents);
+
+    double text_center_x = x + NODE_WIDTH / 2.0;
+    double text_center_y = y + NODE_HEIGHT / 2.0;
+
+    cairo_move_to(cr, text_center_x - extents.width / 2.0, text_center_y + extents.height / 2.0);
+    cairo_show_text(cr, text);
+}
+
+// Texte affiché pour une valeur de la liste
+static void list_format_value(const List *list, const void *value, gchar *text, size_t text_size) {
+    if (g_strcmp0(list->element_type, "Entiers (Int)") == 0) {
+        g_snprintf(text, text_size, "%d", *(const int *)value);
+    } else if (g_strcmp0(list->element_type, "Réels (Float)") == 0) {
+        g_snprintf(text, text_size, "%.2f", *(const float *)value);
+    } else if (g_strcmp0(list->element_type, "Caractères (Char)") == 0) {
+        g_snprintf(text, text_size, "%c", *(const char *)value);
+    } else if (g_strcmp0(list->element_type, "Chaîne de Caractères") == 0) {
+        const char *str = *(const char * const *)value;
+        if (str) {
+            g_snprintf(text, text_size, "%.15s", str); // Limiter à 15 caractères pour l'affichage
+        } else {
+            g_snprintf(text, text_size, "(null)");
+        }
+    } else {
+        g_snprintf(text, text_size, "Data");
+    }
+}
+
+// Géométrie de la liste déroulée: un bloc = count cellules + une zone de lien (next/prev)
+#define UNROLLED_CELL_WIDTH 56.0
+#define UNROLLED_LINK_WIDTH 20.0
+
+static double unrolled_block_width(const ListBlock *block) {
+    return block->count * UNROLLED_CELL_WIDTH + UNROLLED_LINK_WIDTH;
+}
+
+// Dessin de la liste déroulée: chaque bloc est un rectangle de cellules contiguës,
+// annoté de son taux de remplissage, relié au bloc suivant par une flèche.
+// Seuls les blocs coupant [clip_x1, clip_x2] sont dessinés; les autres ne coûtent qu'une addition.
+static void draw_unrolled_list(cairo_t *cr, List *list, double height, double clip_x1, double clip_x2) {
+    double y = height / 2.0 - NODE_HEIGHT / 2.0;
+    double head_x = 10;
+    draw_special_node(cr, head_x, y, "Tête", TRUE);
+    draw_arrow(cr, head_x + NODE_WIDTH, y + NODE_HEIGHT / 2.0, head_x + NODE_WIDTH + SPACING, y + NODE_HEIGHT / 2.0);
+
+    double x = head_x + NODE_WIDTH + SPACING;
+    for (ListBlock *block = list->first_block; block; block = block->next) {
+        double block_width = unrolled_block_width(block);
+        if (x + block_width + SPACING < clip_x1) {
+            x += block_width + SPACING;
+            continue;
+        }
+        if (x - SPACING > clip_x2) return; // NULL hors de la zone visible
+
+        // Cadre du bloc (couleur selon le remplissage)
+        double fill = (double)block->count / block->capacity;
+        cairo_set_source_rgb(cr, 0.2, 0.2, 0.25);
+        cairo_rectangle(cr, x, y, block_width, NODE_HEIGHT);
+        cairo_fill_preserve(cr);
+        cairo_set_source_rgb(cr, 1.0 - fill, 0.95, 0.4 * fill);
+        cairo_set_line_width(cr, 1.5);
+        cairo_stroke(cr);
+
+        cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_BOLD);
+        for (guint32 i = 0; i < block->count; i++) {
+            double cell_x = x + i * UNROLLED_CELL_WIDTH;
+            if (i > 0) {
+                cairo_set_source_rgb(cr, 0.4, 0.4, 0.5); // Séparateur de cellule
+                cairo_move_to(cr, cell_x, y + 6);
+                cairo_line_to(cr, cell_x, y + NODE_HEIGHT - 6);
+                cairo_stroke(cr);
+            }
+            gchar text[64];
+            list_format_value(list, block->items + i * list->element_size, text, sizeof(text));
+            cairo_set_source_rgb(cr, 1.0, 1.0, 1.0);
+            cairo_set_font_size(cr, 12);
+            cairo_text_extents_t extents;
+            cairo_text_extents(cr, text, &extents);
+            cairo_move_to(cr, cell_x + (UNROLLED_CELL_WIDTH - extents.width) / 2.0, y + (NODE_HEIGHT + extents.height) / 2.0);
+            cairo_show_text(cr, text);
+        }
+
+        // Zone de lien
+        double link_x = x + block->count * UNROLLED_CELL_WIDTH;
+        cairo_set_source_rgb(cr, 0.4, 0.4, 0.5);
+        cairo_move_to(cr, link_x, y);
+        cairo_line_to(cr, link_x, y + NODE_HEIGHT);
+        cairo_stroke(cr);
+
+        // Taux de remplissage au-dessus du bloc
+        gchar label[32];
+        g_snprintf(label, sizeof(label), "%u/%u", block->count, block->capacity);
+        cairo_set_source_rgb(cr, 0.7, 0.7, 0.8);
+        cairo_set_font_size(cr, 11);
+        cairo_move_to(cr, x, y - 8);
+        cairo_show_text(cr, label);
+
+        double next_x = x + block_width + SPACING;
+        draw_arrow(cr, link_x + UNROLLED_LINK_WIDTH / 2.0, y + NODE_HEIGHT / 2.0, next_x, y + NODE_HEIGHT / 2.0);
+        if (block->prev) {
+            draw_arrow(cr, x + 4, y + NODE_HEIGHT * 0.85, x - SPACING, y + NODE_HEIGHT * 0.85);
+        }
+        x = next_x;
+    }
+    draw_special_node(cr, x, y, "NULL", FALSE);
+}
+
+// Géométrie de la liste à sauts: nœuds alignés comme une liste classique (rang r en x = 10 + r * pas),
+// tours de niveaux empilées au-dessus du nœud
+#define SKIP_LEVEL_HEIGHT 24.0
+
+static double skip_position_x(size_t rank) {
+    return 10 + rank * (NODE_WIDTH + SPACING);
+}
+
+// Boîtes de la tour d'un nœud (ou de la sentinelle, rang 0) à partir du niveau 1
+static void draw_skip_tower(cairo_t *cr, int levels, size_t rank, double base_y) {
+    double x = skip_position_x(rank);
+    for (int lv = 1; lv < levels; lv++) {
+        double y = base_y - lv * SKIP_LEVEL_HEIGHT;
+        cairo_set_source_rgb(cr, 0.25, 0.2, 0.35);
+        cairo_rectangle(cr, x + NODE_WIDTH * 0.2, y, NODE_WIDTH * 0.6, SKIP_LEVEL_HEIGHT - 6);
+        cairo_fill_preserve(cr);
+        cairo_set_source_rgb(cr, 0.7, 0.5, 1.0);
+        cairo_set_line_width(cr, 1.0);
+        cairo_stroke(cr);
+    }
+}
+
+// Lien de niveau lv d'un nœud de rang 'rank'. Le niveau 0 suit la flèche "next" classique;
+// les niveaux supérieurs sont annotés de leur largeur.
+static void draw_skip_link(cairo_t *cr, const SkipNode *node, int lv, size_t rank, size_t size, double base_y) {
+    double x = skip_position_x(rank);
+    double y = (lv == 0) ? base_y + NODE_HEIGHT / 2.0 : base_y - lv * SKIP_LEVEL_HEIGHT + (SKIP_LEVEL_HEIGHT - 6) / 2.0;
+    double start_x = (lv == 0) ? x + NODE_WIDTH * 0.75 : x + NODE_WIDTH * 0.8;
+    size_t target_rank = node->links[lv].next ? rank + node->links[lv].width : size + 1; // NULL après le dernier
+    double end_x = skip_position_x(target_rank) + ((lv == 0) ? 0 : NODE_WIDTH * 0.2);
+    draw_arrow(cr, start_x, y, end_x, y);
+
+    if (lv > 0 && node->links[lv].next) {
+        gchar label[32];
+        g_snprintf(label, sizeof(label), "%zu", node->links[lv].width);
+        cairo_set_source_rgb(cr, 0.7, 0.7, 0.8);
+        cairo_set_font_size(cr, 10);
+        cairo_move_to(cr, (start_x + end_x) / 2.0, y - 3);
+        cairo_show_text(cr, label);
+    }
+}
+
+// Liste à sauts limitée aux rangs visibles [first_slot, last_slot] (0 = Tête, size + 1 = NULL).
+// Les liens qui entrent dans la zone depuis la gauche partent des prédécesseurs par niveau,
+// trouvés par une descente en O(log n).
+static void draw_skip_list(cairo_t *cr, List *list, double height, size_t first_slot, size_t last_slot) {
+    double base_y = height / 2.0 - NODE_HEIGHT / 2.0;
+
+    SkipNode *x = list->skip_head;
+    size_t rank = 0;
+    for (int lv = list->skip_level - 1; lv >= 0; lv--) {
+        while (x->links[lv].next && rank + x->links[lv].width < first_slot) {
+            rank += x->links[lv].width;
+            x = x->links[lv].next;
+        }
+        if (rank < first_slot) draw_skip_link(cr, x, lv, rank, list->size, base_y);
+    }
+
+    if (first_slot == 0) {
+        draw_special_node(cr, skip_position_x(0), base_y, "Tête", TRUE);
+        draw_skip_tower(cr, list->skip_level, 0, base_y);
+        for (int lv = 0; lv < list->skip_level; lv++) draw_skip_link(cr, list->skip_head, lv, 0, list->size, base_y);
+    }
+
+    rank = MAX(first_slot, 1);
+    for (SkipNode *node = skip_at(list, rank - 1); node && rank <= last_slot; node = node->links[0].next, rank++) {
+        gchar text[64];
+        list_format_value(list, &node->payload, text, sizeof(text));
+        draw_node(cr, skip_position_x(rank), base_y, text, FALSE);
+        draw_skip_tower(cr, node->level, rank, base_y);
+        for (int lv = 0; lv < node->level; lv++) draw_skip_link(cr, node, lv, rank, list->size, base_y);
+    }
+    if (last_slot == list->size + 1) draw_special_node(cr, skip_position_x(list->size + 1), base_y, "NULL", FALSE);
+}
+
+// Emplacements (0 = Tête, 1..size = nœuds, size + 1 = NULL) coupant l'intervalle [x1, x2].
+// Un emplacement p occupe [10 + p * pas, 10 + (p + 1) * pas[ avec sa flèche vers le suivant.
+static void list_visible_slots(double x1, double x2, size_t size, size_t *first_slot, size_t *last_slot) {
+    double pitch = NODE_WIDTH + SPACING;
+    double first = floor((x1 - 10) / pitch);
+    double last = floor((x2 - 10) / pitch);
+    *first_slot = (size_t)CLAMP(first, 0.0, (double)(size + 1));
+    *last_slot = (size_t)CLAMP(last, 0.0, (double)(size + 1));
+}
+
+static gboolean draw_list_callback(GtkWidget *widget, cairo_t *cr, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    List *list = app_data->current_list;
+    guint width = gtk_widget_get_allocated_width(widget);
+    guint height = gtk_widget_get_allocated_height(widget);
+
+    cairo_set_source_rgb(cr, 0.1, 0.1, 0.12); // Dark BG
+    cairo_paint(cr);
+    cairo_set_source_rgb(cr, 1.0, 1.0, 1.0); // White text/lines
+
+    if (!list || list->size == 0) {
+        cairo_set_source_rgb(cr, 1.0, 1.0, 1.0); // White text/lines
+        cairo_move_to(cr, width / 2.0 - 50, height / 2.0);
+        cairo_show_text(cr, "Liste Vide");
+        return TRUE;
+    }
+
+    // Seule la partie visible de la fenêtre défilante (zone de découpage) est dessinée
+    double clip_x1, clip_y1, clip_x2, clip_y2;
+    cairo_clip_extents(cr, &clip_x1, &clip_y1, &clip_x2, &clip_y2);
+
+    if (list_is_unrolled(list)) {
+        draw_unrolled_list(cr, list, height, clip_x1, clip_x2);
+        return TRUE;
+    }
+
+    size_t first_slot, last_slot;
+    list_visible_slots(clip_x1, clip_x2, list->size, &first_slot, &last_slot);
+
+    if (list_is_skip(list)) {
+        draw_skip_list(cr, list, height, first_slot, last_slot);
+        return TRUE;
+    }
+
+    gboolean is_double = g_strcmp0(list->structure_type, "Liste Double") == 0;
+    double y = height / 2.0 - NODE_HEIGHT / 2.0;
+
+    if (first_slot == 0) {
+        // Dessiner "Tête" au début
+        double head_x = 10;
+        draw_special_node(cr, head_x, y, "Tête", TRUE);
+
+        // Flèche de Tête vers le premier nœud
+        double first_node_x = head_x + NODE_WIDTH + SPACING;
+        double arrow_start_x = head_x + NODE_WIDTH;
+        double arrow_end_x = first_node_x;
+        draw_arrow(cr, arrow_start_x, y + NODE_HEIGHT/2.0, arrow_end_x, y + NODE_HEIGHT/2.0);
+    }
+
+    // Nœuds visibles: le premier est atteint via le curseur (get_node_at), puis par next
+    size_t i = MAX(first_slot, 1);
+    size_t end_slot = MIN(last_slot, list->size);
+    Node *current = (i <= end_slot) ? get_node_at(list, (int)i - 1) : NULL;
+
+    for (; current != NULL && i <= end_slot; current = current->next, i++) {
+        double x = 10 + i * (NODE_WIDTH + SPACING);
+        double node_y = y;
+
+        gchar node_text[64];
+        list_format_value(list, current->data, node_text, sizeof(node_text));
+
+        draw_node(cr, x, node_y, node_text, is_double);
+
+        // Flèche Next vers le nœud suivant ou NULL
+        double arrow_start_x = x + NODE_WIDTH * 0.75;
+        double arrow_end_x = x + NODE_WIDTH + SPACING;
+        draw_arrow(cr, arrow_start_x, node_y + NODE_HEIGHT/2.0, arrow_end_x, node_y + NODE_HEIGHT/2.0);
+
+        // Flèche Prev pour les listes doubles
+        if (is_double && current->prev != NULL) {
+             double arrow_start_x = x + NODE_WIDTH * 0.25;
+             double arrow_end_x = x - SPACING;
+             draw_arrow(cr, arrow_start_x, node_y + NODE_HEIGHT * 0.75, arrow_end_x, node_y + NODE_HEIGHT * 0.75);
+        }
+    }
+
+    // Dessiner "NULL" après le dernier nœud
+    if (last_slot == list->size + 1) {
+        draw_special_node(cr, 10 + (list->size + 1) * (NODE_WIDTH + SPACING), y, "NULL", FALSE);
+    }
+
+    return TRUE;
+}
+
+static void update_list_drawing_area_size(AppData *app_data) {
+    if (!app_data->current_list || !app_data->list_drawing_area) return;
+    int n = app_data->current_list->size;
+    // Calculer la largeur nécessaire : Tête + n nœuds de données + NULL + espacement
+    // Tête (1) + n nœuds + NULL (1) = n + 2 nœuds au total
+    // Position de départ (10) + Tête (NODE_WIDTH) + SPACING + n nœuds * (NODE_WIDTH + SPACING) + NULL (NODE_WIDTH) + marge (50)
+    int width = 10 + NODE_WIDTH + SPACING + n * (NODE_WIDTH + SPACING) + NODE_WIDTH + 50;
+    if (list_is_unrolled(app_data->current_list)) {
+        double blocks_width = 0;
+        for (ListBlock *block = app_data->current_list->first_block; block; block = block->next) {
+            blocks_width += unrolled_block_width(block) + SPACING;
+        }
+        width = (int)(10 + NODE_WIDTH + SPACING + blocks_width + NODE_WIDTH + 50);
+    }
+    if (width < 600) width = 600; // Minimum width
+    // Les tours de la liste à sauts montent au-dessus de la ligne centrale
+    int height = 400;
+    if (list_is_skip(app_data->current_list)) {
+        height = MAX(400, (int)(2 * (app_data->current_list->skip_level * SKIP_LEVEL_HEIGHT + NODE_HEIGHT + 40)));
+    }
+    gtk_widget_set_size_request(app_data->list_drawing_area, width, height);
+    gtk_widget_queue_draw(app_data->list_drawing_area);
+}
+
+
+// --- [LISTES] --- Fonctions de Callback (TP2) ---
+
+static void on_list_create_clicked(GtkWidget *widget, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    const gchar *structure_type = gtk_combo_box_text_get_active_text(GTK_COMBO_BOX_TEXT(app_data->list_type_combo));
+    const gchar *element_type = gtk_combo_box_text_get_active_text(GTK_COMBO_BOX_TEXT(app_data->type_combo));
+
+    // L'ancienne liste reste dans l'historique (annulable) au lieu d'être libérée
+    List *previous = app_data->current_list;
+    app_data->current_list = list_new(structure_type, element_type);
+    list_history_record_replace(app_data->list_history, previous);
+
+    gchar *memory_info = list_memory_summary(app_data->current_list);
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
+    gtk_text_buffer_set_text(buffer, g_strdup_printf("Liste créée:\nType: %s\nÉléments: %s\nTaille: 0. Cliquez sur Remplir ou Insérer.\n%s",
+                                                     structure_type, element_type, memory_info), -1);
+    g_free(memory_info);
+
+    gtk_widget_queue_draw(app_data->list_drawing_area);
+    update_list_drawing_area_size(app_data);
+}
+
+// Legacy callbacks removed (on_list_insert_clicked, on_list_delete_clicked)
+static void on_list_input_source_toggled(GtkWidget *widget, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    if (gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(widget))) {
+        const gchar *label = gtk_button_get_label(GTK_BUTTON(widget));
+        if (g_strcmp0(label, "Aléatoire") == 0) {
+            app_data->list_input_source = 0;
+            gtk_widget_show(app_data->list_random_box);
+            gtk_widget_hide(app_data->list_manual_box);
+        } else if (g_strcmp0(label, "Manuelle") == 0) {
+            app_data->list_input_source = 1;
+            gtk_widget_hide(app_data->list_random_box);
+            gtk_widget_show(app_data->list_manual_box);
+        }
+    }
+}
+
+// Tirage uniforme dans [0, bound) sur 30 bits (rand() seul ne couvre que 15 bits sur certaines plateformes)
+static guint32 list_random_below(guint32 bound) {
+    guint32 r = (((guint32)rand() & 0x7FFF) << 15) ^ (guint32)rand();
+    return (r & 0x3FFFFFFF) % bound;
+}
+
+static void on_list_fill_random_clicked(GtkWidget *widget, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    if (!app_data->current_list) on_list_create_clicked(NULL, app_data);
+    if (!app_data->current_list) return;
+    int size = gtk_spin_button_get_value_as_int(app_data->list_size_input);
+    if (size <= 0) return;
+
+    const gchar *element_type = app_data->current_list->element_type;
+    int added_count = 0;
+    int max_attempts = 1000; // Limite pour éviter les boucles infinies
+    // Plage élargie avec la taille finale: au moins 4 valeurs possibles par élément pour rester unique
+    guint32 int_range = (guint32)MAX(10000, (app_data->current_list->size + (size_t)size) * 4);
+    guint32 float_range = (guint32)MAX(100000, (app_data->current_list->size + (size_t)size) * 4);
+    gint64 fill_start = g_get_monotonic_time();
+    // Liste à sauts: les valeurs tirées sont conservées pour l'historique (leurs rangs sont dispersés)
+    size_t es = app_data->current_list->element_size;
+    int start_index = (int)app_data->current_list->size;
+    unsigned char *inserted = list_is_skip(app_data->current_list) ? g_malloc((size_t)size * es) : NULL;
+
+    for(int i=0; i<size; i++) {
+        int attempts = 0;
+        gboolean value_added = FALSE;
+
+        while (!value_added && attempts < max_attempts) {
+            attempts++;
+
+            if (g_strcmp0(element_type, "Entiers (Int)") == 0) {
+                int val = (int)list_random_below(int_range);
+                // Vérifier si la valeur existe déjà (O(1) via l'ensemble de hachage)
+                if (!list_contains_value(app_data->current_list, &val)) {
                     list_insert_generic(app_data->current_list, &val, app_data->current_list->size);
+                    if (inserted) memcpy(inserted + added_count * es, &val, es);
                     value_added = TRUE;
                     added_count++;
                 }
             } else if (g_strcmp0(element_type, "Réels (Float)") == 0) {
-                float val = (float)(rand() % 100000) / 100.0f; // Augmenter la plage
+                float val = (float)list_random_below(float_range) / 100.0f;
                 // Vérifier si la valeur existe déjà
                 if (!list_contains_value(app_data->current_list, &val)) {
                     list_insert_generic(app_data->current_list, &val, app_data->current_list->size);
+                    if (inserted) memcpy(inserted + added_count * es, &val, es);
                     value_added = TRUE;
                     added_count++;
                 }
             } else if (g_strcmp0(element_type, "Caractères (Char)") == 0) {
                 char val = 'A' + (rand() % 26);
                 list_insert_generic(app_data->current_list, &val, app_data->current_list->size);
+                if (inserted) memcpy(inserted + added_count * es, &val, es);
                 value_added = TRUE;
                 added_count++;
             } else if (g_strcmp0(element_type, "Chaîne de Caractères") == 0) {
                 char *str = generate_random_string(5);
                 list_insert_generic(app_data->current_list, &str, app_data->current_list->size);
-                g_free(str); // generate_random_string utilise g_strdup, donc g_free
+                if (inserted) memcpy(inserted + added_count * es, &str, es); // Libérée avec 'inserted'
+                else g_free(str); // generate_random_string utilise g_strdup, donc g_free
                 value_added = TRUE;
                 added_count++;
             } else {
-                int val = rand() % 10000;
+                int val = (int)list_random_below(int_range);
                 if (!list_contains_value(app_data->current_list, &val)) {
                     list_insert_generic(app_data->current_list, &val, app_data->current_list->size);
+                    if (inserted) memcpy(inserted + added_count * es, &val, es);
                     value_added = TRUE;
                     added_count++;
                 }
             }
         }
 
-        if (!value_added) {
-            // Si on n'a pas pu ajouter de valeur unique après max_attempts tentatives
-            // Afficher un avertissement mais continuer
+        if (!value_added) {
+            // Si on n'a pas pu ajouter de valeur unique après max_attempts tentatives
+            // Afficher un avertissement mais continuer
+            break;
+        }
+    }
+
+    list_history_record_insert(app_data->list_history, app_data->current_list, start_index, (size_t)added_count, inserted);
+    list_values_free(inserted, (size_t)added_count, g_strcmp0(element_type, "Chaîne de Caractères") == 0);
+
+    double fill_ms = (double)(g_get_monotonic_time() - fill_start) / 1000.0;
+
+    gchar *memory_info = list_memory_summary(app_data->current_list);
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
+    if (added_count < size) {
+        gtk_text_buffer_set_text(buffer, g_strdup_printf("Ajout de %d éléments aléatoires uniques (sur %d demandés) en %.1f ms. Taille totale: %lu\n⚠️ Impossible de générer plus de valeurs uniques.\n%s",
+                                                         added_count, size, fill_ms, app_data->current_list->size, memory_info), -1);
+    } else {
+        gtk_text_buffer_set_text(buffer, g_strdup_printf("Ajout de %d éléments aléatoires uniques en %.1f ms. Taille totale: %lu\n%s",
+                                                         added_count, fill_ms, app_data->current_list->size, memory_info), -1);
+    }
+    g_free(memory_info);
+    gtk_widget_queue_draw(app_data->list_drawing_area);
+    update_list_drawing_area_size(app_data);
+}
+
+// Saisie manuelle: une ou plusieurs valeurs séparées par des virgules, ajoutées en une construction groupée
+static void on_list_add_manual_clicked(GtkWidget *widget, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    if (!app_data->current_list) on_list_create_clicked(NULL, app_data);
+    if (!app_data->current_list) return;
+
+    const gchar *text = gtk_entry_get_text(app_data->list_value_entry);
+    const gchar *element_type = app_data->current_list->element_type;
+    size_t es = app_data->current_list->element_size;
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
+
+    gchar **tokens = g_strsplit(text ? text : "", ",", -1);
+    guint token_count = g_strv_length(tokens);
+    unsigned char *values = g_malloc(MAX(1, token_count) * es);
+    size_t count = 0;
+    for (guint i = 0; i < token_count; i++) {
+        gchar *token = g_strstrip(tokens[i]);
+        if (*token == '\0') continue;
+        void *slot = values + count * es;
+        if (g_strcmp0(element_type, "Réels (Float)") == 0) {
+            *(float *)slot = (float)atof(token);
+        } else if (g_strcmp0(element_type, "Caractères (Char)") == 0) {
+            *(char *)slot = token[0];
+        } else if (g_strcmp0(element_type, "Chaîne de Caractères") == 0) {
+            *(char **)slot = token; // Dupliquée par la construction
+        } else {
+            *(int *)slot = atoi(token);
+        }
+        count++;
+    }
+
+    if (count == 0) {
+        gtk_text_buffer_set_text(buffer, "Aucune valeur saisie (séparez plusieurs valeurs par des virgules).", -1);
+    } else {
+        int start_index = (int)app_data->current_list->size;
+        gint64 start = g_get_monotonic_time();
+        list_build_from_array(app_data->current_list, values, count);
+        double elapsed_us = (double)(g_get_monotonic_time() - start);
+        list_history_record_insert(app_data->list_history, app_data->current_list, start_index, count, values);
+        gtk_text_buffer_set_text(buffer, g_strdup_printf("%lu élément(s) ajouté(s) manuellement en une construction groupée (%.0f µs). Taille totale: %lu",
+                                                         count, elapsed_us, app_data->current_list->size), -1);
+    }
+    g_free(values);
+    g_strfreev(tokens);
+
+    gtk_widget_queue_draw(app_data->list_drawing_area);
+    update_list_drawing_area_size(app_data);
+}
+
+static void on_list_insert_clicked(GtkWidget *widget, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    if (!app_data->current_list) return;
+
+    const gchar *element_type = app_data->current_list->element_type;
+    int index = app_data->current_list->size;
+
+    if (g_strcmp0(element_type, "Entiers (Int)") == 0) {
+        int value = rand() % 100;
+        list_insert_generic(app_data->current_list, &value, index);
+        GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
+        gtk_text_buffer_set_text(buffer, g_strdup_printf("Insertion de %d à l'index %d. Nouvelle taille: %lu",
+                                                         value, index, app_data->current_list->size), -1);
+    } else if (g_strcmp0(element_type, "Réels (Float)") == 0) {
+        float value = (float)(rand() % 10000) / 100.0f;
+        list_insert_generic(app_data->current_list, &value, index);
+        GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
+        gtk_text_buffer_set_text(buffer, g_strdup_printf("Insertion de %.2f à l'index %d. Nouvelle taille: %lu",
+                                                         value, index, app_data->current_list->size), -1);
+    } else if (g_strcmp0(element_type, "Caractères (Char)") == 0) {
+        char value = 'A' + (rand() % 26);
+        list_insert_generic(app_data->current_list, &value, index);
+        GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
+        gtk_text_buffer_set_text(buffer, g_strdup_printf("Insertion de '%c' à l'index %d. Nouvelle taille: %lu",
+                                                         value, index, app_data->current_list->size), -1);
+    } else if (g_strcmp0(element_type, "Chaîne de Caractères") == 0) {
+        char *str = generate_random_string(5);
+        list_insert_generic(app_data->current_list, &str, index);
+        g_free(str);
+        GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
+        gtk_text_buffer_set_text(buffer, g_strdup_printf("Insertion de chaîne à l'index %d. Nouvelle taille: %lu",
+                                                         index, app_data->current_list->size), -1);
+    } else {
+        int value = rand() % 100;
+        list_insert_generic(app_data->current_list, &value, index);
+        GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
+        gtk_text_buffer_set_text(buffer, g_strdup_printf("Insertion de %d à l'index %d. Nouvelle taille: %lu",
+                                                         value, index, app_data->current_list->size), -1);
+    }
+
+    gtk_widget_queue_draw(app_data->list_drawing_area);
+    update_list_drawing_area_size(app_data);
+}
+
+static void on_list_delete_clicked(GtkWidget *widget, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    if (!app_data->current_list || app_data->current_list->size == 0) return;
+
+    list_delete(app_data->current_list, 0);
+
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
+    gtk_text_buffer_set_text(buffer, g_strdup_printf("Suppression de l'élément à l'index 0. Nouvelle taille: %d",
+                                                     app_data->current_list->size), -1);
+
+    gtk_widget_queue_draw(app_data->list_drawing_area);
+}
+
+// --- Mesure des tris de listes (liste chaînée vs tableau contigu) ---
+
+// Tri de la liste par la méthode nommée (classique ou déroulée). Retourne FALSE si la méthode est inconnue.
+static gboolean list_sort_by_method(List *list, const gchar *method_name) {
+    // Liste déroulée: même méthode, appliquée aux éléments contigus des blocs
+    if (list_is_unrolled(list)) {
+        SortFunction sort_func = NULL;
+        if (g_str_has_suffix(method_name, "Tri à Bulles")) sort_func = bubble_sort;
+        else if (g_str_has_suffix(method_name, "Tri par Insertion")) sort_func = insertion_sort;
+        else if (g_str_has_suffix(method_name, "Tri Shell")) sort_func = shell_sort;
+        else if (g_str_has_suffix(method_name, "Tri Quicksort")) sort_func = quick_sort;
+        else if (!g_str_has_suffix(method_name, "Tri Fusion")) return FALSE;
+        unrolled_sort(list, sort_func);
+        return TRUE;
+    }
+
+    // Comparer avec les noms complets incluant les emojis
+    if (g_strcmp0(method_name, "🔴 Tri à Bulles") == 0 || g_str_has_suffix(method_name, "Tri à Bulles")) {
+        list_bubble_sort(list);
+    } else if (g_strcmp0(method_name, "🟢 Tri par Insertion") == 0 || g_str_has_suffix(method_name, "Tri par Insertion")) {
+        list_insertion_sort(list);
+    } else if (g_strcmp0(method_name, "🔵 Tri Shell") == 0 || g_str_has_suffix(method_name, "Tri Shell")) {
+        list_shell_sort(list);
+    } else if (g_strcmp0(method_name, "🟡 Tri Quicksort") == 0 || g_str_has_suffix(method_name, "Tri Quicksort")) {
+        list_quick_sort(list);
+    } else if (g_str_has_suffix(method_name, "Tri Fusion")) {
+        list_merge_sort(list);
+    } else {
+        return FALSE;
+    }
+    return TRUE;
+}
+
+// Noyau du module Tableaux correspondant à une méthode de liste
+static SortFunction list_method_array_kernel(const gchar *method_name) {
+    if (g_str_has_suffix(method_name, "Tri à Bulles")) return bubble_sort;
+    if (g_str_has_suffix(method_name, "Tri par Insertion")) return insertion_sort;
+    if (g_str_has_suffix(method_name, "Tri Shell")) return shell_sort;
+    if (g_str_has_suffix(method_name, "Tri Quicksort")) return quick_sort;
+    return merge_sort_contiguous;
+}
+
+// Méthode reconnue par list_sort_by_method (à vérifier avant de mesurer ou d'enregistrer quoi que ce soit)
+static gboolean list_method_is_known(const gchar *method_name) {
+    const gchar *SUFFIXES[] = {"Tri à Bulles", "Tri par Insertion", "Tri Shell", "Tri Quicksort", "Tri Fusion"};
+    for (int i = 0; i < 5; i++) {
+        if (g_str_has_suffix(method_name, SUFFIXES[i])) return TRUE;
+    }
+    return FALSE;
+}
+
+// Copie contiguë des valeurs de la liste, dans l'ordre (chaînes: pointeurs partagés, non dupliqués)
+static void *list_gather_values(List *list) {
+    size_t es = list->element_size;
+    unsigned char *values = g_malloc(MAX(list->size, 1) * es);
+    size_t pos = 0;
+    if (list_is_unrolled(list)) {
+        for (ListBlock *block = list->first_block; block; block = block->next) {
+            memcpy(values + pos * es, block->items, block->count * es);
+            pos += block->count;
+        }
+    } else if (list_is_skip(list)) {
+        for (SkipNode *node = list->skip_head ? list->skip_head->links[0].next : NULL; node; node = node->links[0].next) {
+            memcpy(values + (pos++) * es, &node->payload, es);
+        }
+    } else {
+        for (Node *node = list->head; node; node = node->next) {
+            memcpy(values + (pos++) * es, node->data, es);
+        }
+    }
+    return values;
+}
+
+// Trie la liste et, avant cela, une copie contiguë des mêmes valeurs avec le noyau équivalent.
+// Les deux durées (horloge monotone) sont retournées en millisecondes.
+static gboolean list_time_sort_vs_array(List *list, const gchar *method_name, double *list_ms, double *array_ms) {
+    void *values = list_gather_values(list);
+    gint64 start = g_get_monotonic_time();
+    list_method_array_kernel(method_name)(values, list->size, list->element_size, list->compare_func);
+    *array_ms = (double)(g_get_monotonic_time() - start) / 1000.0;
+    g_free(values);
+
+    start = g_get_monotonic_time();
+    gboolean known = list_sort_by_method(list, method_name);
+    *list_ms = (double)(g_get_monotonic_time() - start) / 1000.0;
+    return known;
+}
+
+// Garde-fou des tris de listes en O(N²): bulles et insertion partout, Shell et Quicksort
+// aussi sur les listes chaînées, dont l'accès par index parcourt les nœuds
+static gboolean list_sort_is_quadratic(List *list, const gchar *method_name) {
+    SortFunction kernel = list_method_array_kernel(method_name);
+    if (sort_is_quadratic(kernel)) return TRUE;
+    return !list_is_unrolled(list) && (kernel == shell_sort || kernel == quick_sort);
+}
+
+// Temps prévu (ms) de list_time_sort_vs_array sur toute la liste: mesure sur ses SORT_PROBE_N
+// premières valeurs, copiées dans une liste de même structure, extrapolée en N².
+// 0 pour une méthode en O(N log N) ou une petite liste.
+static double list_predict_sort_ms(List *list, const gchar *method_name) {
+    if (!list_sort_is_quadratic(list, method_name) || list->size <= SORT_PROBE_N) return 0.0;
+    unsigned char *values = list_gather_values(list);
+    List *probe = list_new(list->structure_type, list->element_type);
+    for (int i = 0; i < SORT_PROBE_N; i++) list_insert_generic(probe, values + i * list->element_size, i);
+    g_free(values);
+
+    double list_ms, array_ms;
+    list_time_sort_vs_array(probe, method_name, &list_ms, &array_ms);
+    list_free(probe);
+    double ratio = (double)list->size / SORT_PROBE_N;
+    return (list_ms + array_ms) * ratio * ratio;
+}
+
+#define LIST_SWEEP_POINTS 6
+#define LIST_SWEEP_BUDGET_MS 2000.0 // Au-delà, les tailles suivantes ne sont pas mesurées
+
+typedef struct {
+    gchar *title;
+    int points;                      // Points effectivement mesurés
+    int sizes[LIST_SWEEP_POINTS];
+    double list_ms[LIST_SWEEP_POINTS];
+    double array_ms[LIST_SWEEP_POINTS];
+} ListSweepResult;
+
+static void on_list_sweep_window_destroy(GtkWidget *widget, gpointer data) {
+    ListSweepResult *result = data;
+    g_free(result->title);
+    g_free(result);
+}
+
+// Un panneau du graphique: courbe d'une série, échelle commune aux deux panneaux
+static void draw_list_sweep_panel(cairo_t *cr, const ListSweepResult *result, const double *times, double max_ms,
+                                  double x0, double y0, double w, double h, const char *title, double r, double g, double b) {
+    double padding = 50.0;
+    double graph_w = w - 2 * padding, graph_h = h - 2 * padding;
+    cairo_text_extents_t ext;
+
+    cairo_set_source_rgba(cr, 0.7, 0.7, 0.7, 0.5);
+    cairo_set_line_width(cr, 1.0);
+    for (int i = 0; i <= 5; i++) {
+        double y = y0 + h - padding - i * graph_h / 5.0;
+        cairo_move_to(cr, x0 + padding, y);
+        cairo_line_to(cr, x0 + w - padding, y);
+    }
+    cairo_stroke(cr);
+
+    cairo_set_source_rgb(cr, 0.3, 0.3, 0.3);
+    cairo_set_line_width(cr, 2.0);
+    cairo_move_to(cr, x0 + padding, y0 + padding);
+    cairo_line_to(cr, x0 + padding, y0 + h - padding);
+    cairo_line_to(cr, x0 + w - padding, y0 + h - padding);
+    cairo_stroke(cr);
+
+    cairo_set_source_rgb(cr, 0.0, 0.0, 0.0);
+    cairo_set_font_size(cr, 10);
+    for (int i = 0; i <= 5; i++) {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%.1f ms", max_ms * i / 5.0);
+        cairo_text_extents(cr, buf, &ext);
+        cairo_move_to(cr, x0 + padding - ext.width - 6, y0 + h - padding - i * graph_h / 5.0 + ext.height / 2);
+        cairo_show_text(cr, buf);
+    }
+    for (int j = 0; j < LIST_SWEEP_POINTS; j++) {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%d", result->sizes[j]);
+        cairo_text_extents(cr, buf, &ext);
+        cairo_move_to(cr, x0 + padding + (j + 1) * graph_w / LIST_SWEEP_POINTS - ext.width / 2, y0 + h - padding + ext.height + 5);
+        cairo_show_text(cr, buf);
+    }
+
+    cairo_set_font_size(cr, 13);
+    cairo_text_extents(cr, title, &ext);
+    cairo_move_to(cr, x0 + w / 2 - ext.width / 2, y0 + padding - 15);
+    cairo_show_text(cr, title);
+
+    cairo_set_source_rgb(cr, r, g, b);
+    cairo_set_line_width(cr, 3.0);
+    cairo_move_to(cr, x0 + padding, y0 + h - padding);
+    for (int j = 0; j < result->points; j++) {
+        cairo_line_to(cr, x0 + padding + (j + 1) * graph_w / LIST_SWEEP_POINTS, y0 + h - padding - times[j] / max_ms * graph_h);
+    }
+    cairo_stroke(cr);
+    for (int j = 0; j < result->points; j++) {
+        cairo_arc(cr, x0 + padding + (j + 1) * graph_w / LIST_SWEEP_POINTS, y0 + h - padding - times[j] / max_ms * graph_h, 5, 0, 2 * M_PI);
+        cairo_fill(cr);
+    }
+}
+
+static gboolean draw_list_sweep_callback(GtkWidget *widget, cairo_t *cr, gpointer data) {
+    ListSweepResult *result = data;
+    guint width = gtk_widget_get_allocated_width(widget);
+    guint height = gtk_widget_get_allocated_height(widget);
+
+    cairo_set_source_rgb(cr, 1.0, 1.0, 1.0);
+    cairo_paint(cr);
+
+    // Échelle commune: l'écart vertical entre les deux panneaux est le coût du chaînage
+    double max_ms = 0.001;
+    for (int j = 0; j < result->points; j++) {
+        max_ms = MAX(max_ms, MAX(result->list_ms[j], result->array_ms[j]));
+    }
+    max_ms *= 1.15;
+
+    cairo_set_source_rgb(cr, 0.0, 0.0, 0.0);
+    cairo_set_font_size(cr, 14);
+    cairo_text_extents_t ext;
+    cairo_text_extents(cr, result->title, &ext);
+    cairo_move_to(cr, width / 2.0 - ext.width / 2, 25);
+    cairo_show_text(cr, result->title);
+
+    draw_list_sweep_panel(cr, result, result->list_ms, max_ms, 0, 30, width / 2.0, height - 30, "Liste chaînée", 0.9, 0.2, 0.6);
+    draw_list_sweep_panel(cr, result, result->array_ms, max_ms, width / 2.0, 30, width / 2.0, height - 30, "Tableau contigu", 0.0, 0.6, 1.0);
+    return TRUE;
+}
+
+// Balayage de tailles: listes fraîches d'entiers aléatoires de la structure courante,
+// mesurées contre les mêmes valeurs en tableau, puis affichées côte à côte.
+static void run_list_sort_sweep(AppData *app_data, const gchar *method_name) {
+    const gchar *structure_type = app_data->current_list->structure_type;
+    int max_size = MAX(gtk_spin_button_get_value_as_int(app_data->list_size_input), LIST_SWEEP_POINTS);
+
+    ListSweepResult *result = g_new0(ListSweepResult, 1);
+    GString *report = g_string_new(NULL);
+    g_string_append_printf(report, "Balayage %s sur %s (entiers aléatoires):\n", method_name, structure_type);
+
+    for (int j = 0; j < LIST_SWEEP_POINTS; j++) {
+        result->sizes[j] = max_size * (j + 1) / LIST_SWEEP_POINTS;
+    }
+    for (int j = 0; j < LIST_SWEEP_POINTS; j++) {
+        List *list = list_new(structure_type, "Entiers (Int)");
+        GRand *rng = g_rand_new_with_seed(1000 + j); // Valeurs reproductibles, graine globale intacte
+        for (int i = 0; i < result->sizes[j]; i++) {
+            int value = g_rand_int_range(rng, 0, 1 << 30);
+            list_insert_generic(list, &value, (int)list->size);
+        }
+        g_rand_free(rng);
+        // Point prévu au-delà du budget: ni lui ni les suivants ne sont lancés
+        double predicted_ms = list_predict_sort_ms(list, method_name);
+        if (predicted_ms > LIST_SWEEP_BUDGET_MS) {
+            g_string_append_printf(report, "  N=%d : environ %.0f ms prévues (O(N²)), au-delà du budget de %.0f ms: "
+                                   "tailles suivantes non mesurées\n", result->sizes[j], predicted_ms, LIST_SWEEP_BUDGET_MS);
+            list_free(list);
+            break;
+        }
+        list_time_sort_vs_array(list, method_name, &result->list_ms[j], &result->array_ms[j]);
+        list_free(list);
+        result->points = j + 1;
+
+        g_string_append_printf(report, "  N=%d : liste %.2f ms | tableau %.2f ms | x%.1f\n", result->sizes[j],
+                               result->list_ms[j], result->array_ms[j], result->list_ms[j] / MAX(result->array_ms[j], 0.001));
+        if (result->list_ms[j] > LIST_SWEEP_BUDGET_MS) {
+            g_string_append_printf(report, "  (budget de %.0f ms dépassé: tailles suivantes non mesurées)\n", LIST_SWEEP_BUDGET_MS);
             break;
         }
     }
+    result->title = g_strdup_printf("%s — %s vs tableau contigu (même échelle)", method_name, structure_type);
 
     GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
-    if (added_count < size) {
-        gtk_text_buffer_set_text(buffer, g_strdup_printf("Ajout de %d éléments aléatoires uniques (sur %d demandés). Taille totale: %lu\n⚠️ Impossible de générer plus de valeurs uniques.",
-                                                         added_count, size, app_data->current_list->size), -1);
-    } else {
-        gtk_text_buffer_set_text(buffer, g_strdup_printf("Ajout de %d éléments aléatoires uniques. Taille totale: %lu",
-                                                         added_count, app_data->current_list->size), -1);
+    gtk_text_buffer_set_text(buffer, report->str, -1);
+    g_string_free(report, TRUE);
+    if (result->points == 0) { // Rien à tracer
+        g_free(result->title);
+        g_free(result);
+        return;
     }
-    gtk_widget_queue_draw(app_data->list_drawing_area);
-    update_list_drawing_area_size(app_data);
+
+    GtkWidget *window = gtk_window_new(GTK_WINDOW_TOPLEVEL);
+    gtk_window_set_title(GTK_WINDOW(window), "📈 Tri de Listes vs Tableaux");
+    gtk_window_set_default_size(GTK_WINDOW(window), 1000, 500);
+    gtk_container_set_border_width(GTK_CONTAINER(window), 10);
+    GtkWidget *drawing_area = gtk_drawing_area_new();
+    gtk_widget_set_size_request(drawing_area, 980, 480);
+    gtk_container_add(GTK_CONTAINER(window), drawing_area);
+    g_signal_connect(drawing_area, "draw", G_CALLBACK(draw_list_sweep_callback), result);
+    g_signal_connect(window, "delete-event", G_CALLBACK(on_secondary_window_delete), NULL);
+    g_signal_connect(window, "destroy", G_CALLBACK(on_list_sweep_window_destroy), result);
+    gtk_widget_show_all(window);
 }
 
-static void on_list_add_manual_clicked(GtkWidget *widget, gpointer data) {
+static void on_list_sort_clicked(GtkWidget *widget, gpointer data) {
     AppData *app_data = (AppData *)data;
-    if (!app_data->current_list) on_list_create_clicked(NULL, app_data);
-    if (!app_data->current_list) return;
-
-    const gchar *text = gtk_entry_get_text(app_data->list_value_entry);
-    const gchar *element_type = app_data->current_list->element_type;
-
-    if (g_strcmp0(element_type, "Entiers (Int)") == 0) {
-        int value = atoi(text);
-        list_insert_generic(app_data->current_list, &value, app_data->current_list->size);
+    if (!app_data->current_list || app_data->current_list->size == 0) {
         GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
-        gtk_text_buffer_set_text(buffer, g_strdup_printf("Élément %d ajouté manuellement. Taille totale: %lu",
-                                                         value, app_data->current_list->size), -1);
-    } else if (g_strcmp0(element_type, "Réels (Float)") == 0) {
-        float value = (float)atof(text);
-        list_insert_generic(app_data->current_list, &value, app_data->current_list->size);
+        gtk_text_buffer_set_text(buffer, "Erreur : La liste est vide. Veuillez créer une liste et ajouter des éléments.", -1);
+        return;
+    }
+
+    const gchar *method_name = g_object_get_data(G_OBJECT(widget), "list-method-name");
+    if (!method_name) {
         GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
-        gtk_text_buffer_set_text(buffer, g_strdup_printf("Élément %.2f ajouté manuellement. Taille totale: %lu",
-                                                         value, app_data->current_list->size), -1);
-    } else if (g_strcmp0(element_type, "Caractères (Char)") == 0) {
-        char value = (text && strlen(text) > 0) ? text[0] : 'A';
-        list_insert_generic(app_data->current_list, &value, app_data->current_list->size);
+        gtk_text_buffer_set_text(buffer, "Erreur : Méthode de tri non identifiée.", -1);
+        return;
+    }
+    if (!list_method_is_known(method_name)) {
         GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
-        gtk_text_buffer_set_text(buffer, g_strdup_printf("Élément '%c' ajouté manuellement. Taille totale: %lu",
-                                                         value, app_data->current_list->size), -1);
-    } else if (g_strcmp0(element_type, "Chaîne de Caractères") == 0) {
-        const char *str = text;
-        list_insert_generic(app_data->current_list, &str, app_data->current_list->size);
+        gtk_text_buffer_set_text(buffer, g_strdup_printf("Erreur : Méthode de tri non reconnue : %s", method_name), -1);
+        return;
+    }
+
+    // Liste à sauts: l'ordre des valeurs est un invariant de la structure
+    if (list_is_skip(app_data->current_list)) {
         GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
-        gtk_text_buffer_set_text(buffer, g_strdup_printf("Élément '%s' ajouté manuellement. Taille totale: %lu",
-                                                         text, app_data->current_list->size), -1);
-    } else {
-        int value = atoi(text);
-        list_insert_generic(app_data->current_list, &value, app_data->current_list->size);
+        gtk_text_buffer_set_text(buffer, "La liste à sauts est toujours triée: chaque insertion est placée à son rang (O(log n)). Aucun tri nécessaire.", -1);
+        return;
+    }
+
+    if (app_data->list_sweep_toggle && gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(app_data->list_sweep_toggle))) {
+        run_list_sort_sweep(app_data, method_name);
+        return;
+    }
+
+    double budget_ms = sort_budget_seconds(app_data) * 1000.0;
+    double predicted_ms = list_predict_sort_ms(app_data->current_list, method_name);
+    if (predicted_ms > budget_ms) {
         GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
-        gtk_text_buffer_set_text(buffer, g_strdup_printf("Élément %d ajouté manuellement. Taille totale: %lu",
-                                                         value, app_data->current_list->size), -1);
+        gtk_text_buffer_set_text(buffer, g_strdup_printf("Tri non lancé : %s sur %d éléments prendrait environ %.0f s (O(N²)), "
+                                                         "au-delà du budget de %.1f s. Réduisez la taille de la liste.",
+                                                         method_name, (int)app_data->current_list->size,
+                                                         predicted_ms / 1000.0, budget_ms / 1000.0), -1);
+        return;
     }
 
+    // Méthode validée plus haut: l'étape enregistrée correspond toujours à un tri effectué
+    double list_ms, array_ms;
+    list_history_record_reorder(app_data->list_history, app_data->current_list);
+    list_time_sort_vs_array(app_data->current_list, method_name, &list_ms, &array_ms);
+
+    const gchar *mechanism = list_is_unrolled(app_data->current_list) ? "Tri des éléments contigus des blocs"
+                           : g_str_has_suffix(method_name, "Tri Fusion") ? "Tri par rechaînement des nœuds" : "Tri par échange de données";
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
+    gtk_text_buffer_set_text(buffer, g_strdup_printf("Tri de la liste effectué par : %s. (%s).\n"
+                                                     "Durée: liste %.3f ms | mêmes valeurs en tableau contigu %.3f ms (x%.1f)",
+                                                     method_name, mechanism, list_ms, array_ms, list_ms / MAX(array_ms, 0.001)), -1);
+
     gtk_widget_queue_draw(app_data->list_drawing_area);
-    update_list_drawing_area_size(app_data);
 }
 
-static void on_list_insert_clicked(GtkWidget *widget, gpointer data) {
-    AppData *app_data = (AppData *)data;
-    if (!app_data->current_list) return;
+// --- Benchmark de localité (listes classiques vs liste déroulée) ---
 
-    const gchar *element_type = app_data->current_list->element_type;
-    int index = app_data->current_list->size;
+static volatile long list_benchmark_sink; // Empêche l'élimination des parcours par le compilateur
 
-    if (g_strcmp0(element_type, "Entiers (Int)") == 0) {
-        int value = rand() % 100;
-        list_insert_generic(app_data->current_list, &value, index);
-        GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
-        gtk_text_buffer_set_text(buffer, g_strdup_printf("Insertion de %d à l'index %d. Nouvelle taille: %lu",
-                                                         value, index, app_data->current_list->size), -1);
-    } else if (g_strcmp0(element_type, "Réels (Float)") == 0) {
-        float value = (float)(rand() % 10000) / 100.0f;
-        list_insert_generic(app_data->current_list, &value, index);
-        GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
-        gtk_text_buffer_set_text(buffer, g_strdup_printf("Insertion de %.2f à l'index %d. Nouvelle taille: %lu",
-                                                         value, index, app_data->current_list->size), -1);
-    } else if (g_strcmp0(element_type, "Caractères (Char)") == 0) {
-        char value = 'A' + (rand() % 26);
-        list_insert_generic(app_data->current_list, &value, index);
-        GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
-        gtk_text_buffer_set_text(buffer, g_strdup_printf("Insertion de '%c' à l'index %d. Nouvelle taille: %lu",
-                                                         value, index, app_data->current_list->size), -1);
-    } else if (g_strcmp0(element_type, "Chaîne de Caractères") == 0) {
-        char *str = generate_random_string(5);
-        list_insert_generic(app_data->current_list, &str, index);
-        g_free(str);
-        GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
-        gtk_text_buffer_set_text(buffer, g_strdup_printf("Insertion de chaîne à l'index %d. Nouvelle taille: %lu",
-                                                         index, app_data->current_list->size), -1);
+// Parcours complet d'une liste d'entiers (somme des valeurs), en millisecondes
+static double list_benchmark_traversal(List *list) {
+    gint64 start = g_get_monotonic_time();
+    long sum = 0;
+    if (list_is_unrolled(list)) {
+        for (ListBlock *block = list->first_block; block; block = block->next) {
+            const int *items = (const int *)block->items;
+            for (guint32 i = 0; i < block->count; i++) sum += items[i];
+        }
     } else {
-        int value = rand() % 100;
-        list_insert_generic(app_data->current_list, &value, index);
-        GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
-        gtk_text_buffer_set_text(buffer, g_strdup_printf("Insertion de %d à l'index %d. Nouvelle taille: %lu",
-                                                         value, index, app_data->current_list->size), -1);
+        for (Node *node = list->head; node; node = node->next) sum += *(const int *)node->data;
+    }
+    list_benchmark_sink = sum;
+    return (double)(g_get_monotonic_time() - start) / 1000.0;
+}
+
+static void on_list_locality_benchmark_clicked(GtkWidget *widget, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    int n = gtk_spin_button_get_value_as_int(app_data->list_size_input);
+    if (n <= 0) return;
+
+    const int positional_inserts = 200;
+    const gchar *STRUCTURES[] = {"Liste Simple", "Liste Double", "Liste Déroulée"};
+
+    GString *report = g_string_new(NULL);
+    g_string_append_printf(report, "Benchmark de localité (N = %d entiers, %d insertions à des positions aléatoires)\n",
+                           n, positional_inserts);
+    g_string_append(report, "Structure : parcours | insertions pos. | tri fusion | parcours après tri\n");
+
+    for (int s = 0; s < 3; s++) {
+        List *list = list_new(STRUCTURES[s], "Entiers (Int)");
+        // Générateur local: mêmes valeurs et mêmes positions pour les trois structures,
+        // sans toucher à la graine globale de rand()
+        GRand *rng = g_rand_new_with_seed(42);
+        for (int i = 0; i < n; i++) {
+            int value = g_rand_int_range(rng, 0, G_MAXINT);
+            list_insert_generic(list, &value, (int)list->size);
+        }
+
+        double traversal_ms = list_benchmark_traversal(list);
+
+        gint64 start = g_get_monotonic_time();
+        for (int k = 0; k < positional_inserts; k++) {
+            int value = g_rand_int_range(rng, 0, G_MAXINT);
+            list_insert_generic(list, &value, g_rand_int_range(rng, 0, (gint32)list->size + 1));
+        }
+        double insert_ms = (double)(g_get_monotonic_time() - start) / 1000.0;
+        g_rand_free(rng);
+
+        start = g_get_monotonic_time();
+        if (list_is_unrolled(list)) unrolled_sort(list, NULL);
+        else list_merge_sort(list);
+        double sort_ms = (double)(g_get_monotonic_time() - start) / 1000.0;
+
+        // Après le tri fusion, les nœuds classiques sont rechaînés dans un ordre dispersé en mémoire
+        double traversal_sorted_ms = list_benchmark_traversal(list);
+
+        g_string_append_printf(report, "%s : %.2f ms | %.2f ms | %.2f ms | %.2f ms\n",
+                               STRUCTURES[s], traversal_ms, insert_ms, sort_ms, traversal_sorted_ms);
+        list_free(list);
+    }
+
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
+    gtk_text_buffer_set_text(buffer, report->str, -1);
+    g_string_free(report, TRUE);
+}
+
+// --- Benchmark des motifs d'accès par index (parcours depuis la tête vs curseur) ---
+
+// Ancien accès: toujours depuis la tête
+static Node *list_node_from_head(List *list, int index) {
+    Node *current = list->head;
+    for (int i = 0; i < index; i++) current = current->next;
+    return current;
+}
+
+// Index du k-ième accès selon le motif: 0 = séquentiel croissant, 1 = décroissant, 2 = local (±16), 3 = aléatoire
+static int list_access_pattern_index(GRand *rng, int pattern, int k, int n, int previous) {
+    switch (pattern) {
+        case 0: return k;
+        case 1: return n - 1 - k;
+        case 2: return CLAMP(previous + g_rand_int_range(rng, -16, 17), 0, n - 1);
+        default: return g_rand_int_range(rng, 0, n);
+    }
+}
+
+static void on_list_access_benchmark_clicked(GtkWidget *widget, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    // L'accès depuis la tête est quadratique: taille plafonnée pour garder le benchmark court
+    int n = MIN(gtk_spin_button_get_value_as_int(app_data->list_size_input), 20000);
+    if (n <= 0) return;
+
+    const gchar *STRUCTURES[] = {"Liste Simple", "Liste Double"};
+    const gchar *PATTERNS[] = {"Séquentiel ↑", "Séquentiel ↓", "Local (±16)", "Aléatoire"};
+
+    GString *report = g_string_new(NULL);
+    g_string_append_printf(report, "Motifs d'accès par index (N = %d, %d accès par motif)\n", n, n);
+    g_string_append(report, "Structure / motif : depuis la tête | tête/curseur/queue | gain\n");
+
+    for (int s = 0; s < 2; s++) {
+        List *list = list_new(STRUCTURES[s], "Entiers (Int)");
+        for (int i = 0; i < n; i++) list_insert_int(list, i, i);
+
+        for (int pattern = 0; pattern < 4; pattern++) {
+            double elapsed[2];
+            for (int mode = 0; mode < 2; mode++) {
+                GRand *rng = g_rand_new_with_seed(7 + pattern); // Même suite d'index pour les deux modes
+                list->cursor = NULL;
+                long sum = 0;
+                int index = n / 2;
+                gint64 start = g_get_monotonic_time();
+                for (int k = 0; k < n; k++) {
+                    index = list_access_pattern_index(rng, pattern, k, n, index);
+                    Node *node = mode == 0 ? list_node_from_head(list, index) : get_node_at(list, index);
+                    sum += *(const int *)node->data;
+                }
+                elapsed[mode] = (double)(g_get_monotonic_time() - start) / 1000.0;
+                list_benchmark_sink = sum;
+                g_rand_free(rng);
+            }
+            g_string_append_printf(report, "%s / %s : %.2f ms | %.2f ms | x%.1f\n", STRUCTURES[s], PATTERNS[pattern],
+                                   elapsed[0], elapsed[1], elapsed[0] / MAX(elapsed[1], 0.001));
+        }
+        list_free(list);
+    }
+
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
+    gtk_text_buffer_set_text(buffer, report->str, -1);
+    g_string_free(report, TRUE);
+}
+
+// --- [LISTES] --- Liste triée concurrente: sans verrou (Harris) et sous mutex ---
+
+#define CONC_MAX_THREADS 16
+#define CONC_RUN_MS 200       // Durée de chaque mesure
+#define CONC_RETIRE_BATCH 32  // Tentative d'avancée de l'époque tous les N retraits
+
+// Nœud d'ensemble trié d'entiers. Le bit de poids faible de 'next' marque le nœud
+// comme supprimé logiquement (Harris): plus aucune insertion ne peut se greffer derrière lui.
+typedef struct ConcNode {
+    int key;
+    struct ConcNode *next;
+    struct ConcNode *retired_next; // Chaînage des nœuds retirés ('next' peut encore être lu par d'autres threads)
+} ConcNode;
+
+// État par thread de la récupération par époques
+typedef struct {
+    ConcNode *limbo[3];   // Nœuds retirés, rangés par époque de retrait modulo 3
+    gint limbo_epoch[3];  // Époque de retrait des nœuds de chaque case
+    volatile gint active; // Thread dans une opération (section critique de lecture)
+    volatile gint epoch;  // Époque globale observée à l'entrée
+    guint retired;
+    guint64 reclaimed;
+    char padding[64];     // Évite le faux partage entre enregistrements voisins
+} ConcThreadRecord;
+
+typedef struct {
+    ConcNode head;         // Sentinelle de clé INT_MIN
+    gboolean use_mutex;    // Référence: liste simple protégée par un verrou global
+    GMutex lock;
+    volatile gint epoch;   // Époque globale
+    int thread_count;
+    ConcThreadRecord records[CONC_MAX_THREADS];
+} ConcList;
+
+static gboolean conc_is_marked(const ConcNode *p) {
+    return ((guintptr)p & 1) != 0;
+}
+
+static ConcNode *conc_mark(const ConcNode *p) {
+    return (ConcNode *)((guintptr)p | 1);
+}
+
+static ConcNode *conc_unmark(const ConcNode *p) {
+    return (ConcNode *)((guintptr)p & ~(guintptr)1);
+}
+
+static ConcList *conc_list_new(gboolean use_mutex, int thread_count) {
+    ConcList *list = g_new0(ConcList, 1);
+    list->head.key = INT_MIN;
+    list->use_mutex = use_mutex;
+    list->thread_count = thread_count;
+    if (use_mutex) g_mutex_init(&list->lock);
+    return list;
+}
+
+static void conc_free_chain(ConcNode *node, guint64 *count) {
+    while (node) {
+        ConcNode *next = node->retired_next;
+        g_free(node);
+        if (count) (*count)++;
+        node = next;
+    }
+}
+
+// Appelée une fois tous les threads terminés
+static void conc_list_free(ConcList *list) {
+    ConcNode *node = conc_unmark(list->head.next);
+    while (node) {
+        ConcNode *next = conc_unmark(node->next);
+        g_free(node);
+        node = next;
+    }
+    for (int t = 0; t < CONC_MAX_THREADS; t++) {
+        for (int e = 0; e < 3; e++) conc_free_chain(list->records[t].limbo[e], NULL);
+    }
+    if (list->use_mutex) g_mutex_clear(&list->lock);
+    g_free(list);
+}
+
+// --- Récupération mémoire par époques (3 listes de retraits par thread) ---
+// L'époque globale ne passe de G à G+1 que lorsque tous les threads actifs ont observé G.
+// Un nœud détaché puis retiré pendant l'époque e ne peut plus être tenu par aucun thread
+// quand l'époque globale vaut e+2: il est alors libéré.
+
+static void conc_free_limbo(ConcThreadRecord *rec, int slot) {
+    conc_free_chain(rec->limbo[slot], &rec->reclaimed);
+    rec->limbo[slot] = NULL;
+}
+
+static void conc_epoch_enter(ConcList *list, ConcThreadRecord *rec) {
+    // Activité publiée avant la lecture de l'époque: une avancée concurrente attend ce thread
+    g_atomic_int_set(&rec->active, 1);
+    gint global = g_atomic_int_get(&list->epoch);
+    if (global != rec->epoch) {
+        for (int slot = 0; slot < 3; slot++) {
+            if (rec->limbo[slot] && rec->limbo_epoch[slot] <= global - 2) conc_free_limbo(rec, slot);
+        }
+        g_atomic_int_set(&rec->epoch, global);
+    }
+}
+
+static void conc_epoch_exit(ConcThreadRecord *rec) {
+    g_atomic_int_set(&rec->active, 0);
+}
+
+static void conc_epoch_try_advance(ConcList *list) {
+    gint global = g_atomic_int_get(&list->epoch);
+    for (int t = 0; t < list->thread_count; t++) {
+        ConcThreadRecord *other = &list->records[t];
+        if (g_atomic_int_get(&other->active) && g_atomic_int_get(&other->epoch) != global) return;
+    }
+    g_atomic_int_compare_and_exchange(&list->epoch, global, global + 1);
+}
+
+// À appeler après le détachement physique du nœud
+static void conc_retire(ConcList *list, ConcThreadRecord *rec, ConcNode *node) {
+    gint epoch = g_atomic_int_get(&list->epoch);
+    int slot = epoch % 3;
+    // Case occupée par une époque <= epoch - 3: ses nœuds sont libérables
+    if (rec->limbo[slot] && rec->limbo_epoch[slot] != epoch) conc_free_limbo(rec, slot);
+    rec->limbo_epoch[slot] = epoch;
+    node->retired_next = rec->limbo[slot];
+    rec->limbo[slot] = node;
+    if (++rec->retired % CONC_RETIRE_BATCH == 0) conc_epoch_try_advance(list);
+}
+
+// --- Liste de Harris (variante de Michael: les nœuds marqués sont détachés pendant la recherche) ---
+
+// Positionne *prev_link sur le lien qui pointe vers le premier nœud de clé >= key (*curr).
+// Les nœuds marqués rencontrés sont détachés puis retirés. Retourne TRUE si la clé est présente.
+static gboolean conc_find(ConcList *list, ConcThreadRecord *rec, int key, ConcNode ***prev_link, ConcNode **curr) {
+retry:
+    *prev_link = &list->head.next;
+    *curr = g_atomic_pointer_get(*prev_link);
+    while (*curr) {
+        ConcNode *next = g_atomic_pointer_get(&(*curr)->next);
+        if (conc_is_marked(next)) {
+            // Le lien du prédécesseur a changé (ou il est marqué lui-même): on recommence depuis la tête
+            if (!g_atomic_pointer_compare_and_exchange(*prev_link, *curr, conc_unmark(next))) goto retry;
+            conc_retire(list, rec, *curr);
+            *curr = conc_unmark(next);
+        } else {
+            if ((*curr)->key >= key) return (*curr)->key == key;
+            *prev_link = &(*curr)->next;
+            *curr = next;
+        }
+    }
+    return FALSE;
+}
+
+static gboolean conc_insert(ConcList *list, ConcThreadRecord *rec, int key) {
+    ConcNode *node = g_new0(ConcNode, 1); // Allocation hors section critique dans les deux variantes
+    node->key = key;
+    if (list->use_mutex) {
+        g_mutex_lock(&list->lock);
+        ConcNode *prev = &list->head;
+        while (prev->next && prev->next->key < key) prev = prev->next;
+        gboolean inserted = !(prev->next && prev->next->key == key);
+        if (inserted) {
+            node->next = prev->next;
+            prev->next = node;
+        }
+        g_mutex_unlock(&list->lock);
+        if (!inserted) g_free(node);
+        return inserted;
+    }
+
+    conc_epoch_enter(list, rec);
+    for (;;) {
+        ConcNode **prev_link, *curr;
+        if (conc_find(list, rec, key, &prev_link, &curr)) {
+            conc_epoch_exit(rec);
+            g_free(node); // Jamais publié
+            return FALSE;
+        }
+        node->next = curr;
+        if (g_atomic_pointer_compare_and_exchange(prev_link, curr, node)) break;
+    }
+    conc_epoch_exit(rec);
+    return TRUE;
+}
+
+static gboolean conc_delete(ConcList *list, ConcThreadRecord *rec, int key) {
+    if (list->use_mutex) {
+        g_mutex_lock(&list->lock);
+        ConcNode *prev = &list->head;
+        while (prev->next && prev->next->key < key) prev = prev->next;
+        ConcNode *victim = (prev->next && prev->next->key == key) ? prev->next : NULL;
+        if (victim) prev->next = victim->next;
+        g_mutex_unlock(&list->lock);
+        g_free(victim);
+        return victim != NULL;
+    }
+
+    conc_epoch_enter(list, rec);
+    for (;;) {
+        ConcNode **prev_link, *curr;
+        if (!conc_find(list, rec, key, &prev_link, &curr)) {
+            conc_epoch_exit(rec);
+            return FALSE;
+        }
+        ConcNode *next = g_atomic_pointer_get(&curr->next);
+        if (conc_is_marked(next)) continue;
+        // Suppression logique (point de linéarisation), puis tentative de détachement physique
+        if (!g_atomic_pointer_compare_and_exchange(&curr->next, next, conc_mark(next))) continue;
+        if (g_atomic_pointer_compare_and_exchange(prev_link, curr, next)) conc_retire(list, rec, curr);
+        else conc_find(list, rec, key, &prev_link, &curr); // Un autre parcours finira le détachement
+        break;
+    }
+    conc_epoch_exit(rec);
+    return TRUE;
+}
+
+// Recherche sans écriture: les marques sont seulement lues
+static gboolean conc_contains(ConcList *list, ConcThreadRecord *rec, int key) {
+    if (list->use_mutex) {
+        g_mutex_lock(&list->lock);
+        ConcNode *curr = list->head.next;
+        while (curr && curr->key < key) curr = curr->next;
+        gboolean found = curr && curr->key == key;
+        g_mutex_unlock(&list->lock);
+        return found;
+    }
+
+    conc_epoch_enter(list, rec);
+    ConcNode *curr = conc_unmark(g_atomic_pointer_get(&list->head.next));
+    while (curr && curr->key < key) curr = conc_unmark(g_atomic_pointer_get(&curr->next));
+    gboolean found = curr && curr->key == key && !conc_is_marked(g_atomic_pointer_get(&curr->next));
+    conc_epoch_exit(rec);
+    return found;
+}
+
+// Clés présentes (nœuds non marqués), dans l'ordre; à appeler une fois les threads arrêtés
+static int *conc_list_keys(ConcList *list, size_t *count, gboolean *sorted) {
+    size_t n = 0;
+    for (ConcNode *node = conc_unmark(list->head.next); node; node = conc_unmark(node->next)) {
+        if (!conc_is_marked(node->next)) n++;
+    }
+    int *keys = g_new(int, MAX(n, 1));
+    *count = 0;
+    *sorted = TRUE;
+    for (ConcNode *node = conc_unmark(list->head.next); node; node = conc_unmark(node->next)) {
+        if (conc_is_marked(node->next)) continue;
+        if (*count > 0 && keys[*count - 1] >= node->key) *sorted = FALSE;
+        keys[(*count)++] = node->key;
+    }
+    return keys;
+}
+
+// --- Benchmark: T threads en opérations mixtes (20 % insertions, 20 % suppressions, 60 % recherches) ---
+
+typedef struct {
+    ConcList *list;
+    ConcThreadRecord *rec;
+    int key_range;
+    guint32 seed;
+    volatile gint *start;
+    volatile gint *stop;
+    guint64 ops;
+    gint64 inserted; // Succès, pour vérifier la taille finale
+    gint64 deleted;
+} ConcWorker;
+
+static gpointer conc_worker_thread(gpointer data) {
+    ConcWorker *worker = data;
+    guint32 x = worker->seed | 1;
+    while (!g_atomic_int_get(worker->start)) ; // Départ simultané
+    while (!g_atomic_int_get(worker->stop)) {
+        // xorshift32: générateur propre au thread (rand() n'est pas réentrant)
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        int key = (int)(x % (guint32)worker->key_range);
+        guint32 op = (x >> 24) % 100;
+        if (op < 20) worker->inserted += conc_insert(worker->list, worker->rec, key);
+        else if (op < 40) worker->deleted += conc_delete(worker->list, worker->rec, key);
+        else conc_contains(worker->list, worker->rec, key);
+        worker->ops++;
+    }
+    return NULL;
+}
+
+typedef struct {
+    int points;
+    int threads[5];
+    double lock_free_mops[5];
+    double mutex_mops[5];
+} ConcBenchResult;
+
+// Une mesure: liste pré-remplie à moitié, T threads pendant CONC_RUN_MS.
+// Retourne le débit en millions d'opérations par seconde; *consistent vérifie ordre et taille.
+static double conc_run(ConcList *list, int threads, int key_range, gboolean *consistent, guint64 *reclaimed) {
+    ConcWorker workers[CONC_MAX_THREADS];
+    GThread *handles[CONC_MAX_THREADS];
+    volatile gint start = 0, stop = 0;
+
+    gint64 expected = 0;
+    for (int key = 0; key < key_range; key += 2) expected += conc_insert(list, &list->records[0], key);
+
+    for (int t = 0; t < threads; t++) {
+        workers[t] = (ConcWorker){ .list = list, .rec = &list->records[t], .key_range = key_range,
+                                   .seed = 0x9E3779B9u * (guint32)(t + 1), .start = &start, .stop = &stop };
+        handles[t] = g_thread_new("conc-bench", conc_worker_thread, &workers[t]);
+    }
+    gint64 begin = g_get_monotonic_time();
+    g_atomic_int_set(&start, 1);
+    g_usleep(CONC_RUN_MS * 1000);
+    g_atomic_int_set(&stop, 1);
+    gint64 elapsed = g_get_monotonic_time() - begin;
+
+    guint64 ops = 0;
+    *reclaimed = 0;
+    for (int t = 0; t < threads; t++) {
+        g_thread_join(handles[t]);
+        ops += workers[t].ops;
+        expected += workers[t].inserted - workers[t].deleted;
+        *reclaimed += list->records[t].reclaimed;
+    }
+
+    size_t count;
+    gboolean sorted;
+    g_free(conc_list_keys(list, &count, &sorted));
+    *consistent = sorted && (gint64)count == expected;
+    return (double)ops / (double)MAX(elapsed, 1);
+}
+
+static void draw_conc_bench_axes(cairo_t *cr, const ConcBenchResult *result, double max_mops,
+                                          double padding, double graph_w, double graph_h, guint height) {
+    cairo_text_extents_t ext;
+    cairo_set_source_rgba(cr, 0.7, 0.7, 0.7, 0.5);
+    cairo_set_line_width(cr, 1.0);
+    for (int i = 0; i <= 5; i++) {
+        double y = height - padding - i * graph_h / 5.0;
+        cairo_move_to(cr, padding, y);
+        cairo_line_to(cr, padding + graph_w, y);
+    }
+    cairo_stroke(cr);
+
+    cairo_set_source_rgb(cr, 0.3, 0.3, 0.3);
+    cairo_set_line_width(cr, 2.0);
+    cairo_move_to(cr, padding, padding);
+    cairo_line_to(cr, padding, height - padding);
+    cairo_line_to(cr, padding + graph_w, height - padding);
+    cairo_stroke(cr);
+
+    cairo_set_source_rgb(cr, 0.0, 0.0, 0.0);
+    cairo_set_font_size(cr, 10);
+    for (int i = 0; i <= 5; i++) {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%.2f Mop/s", max_mops * i / 5.0);
+        cairo_text_extents(cr, buf, &ext);
+        cairo_move_to(cr, padding - ext.width - 6, height - padding - i * graph_h / 5.0 + ext.height / 2);
+        cairo_show_text(cr, buf);
+    }
+    for (int j = 0; j < result->points; j++) {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%d thread%s", result->threads[j], result->threads[j] > 1 ? "s" : "");
+        cairo_text_extents(cr, buf, &ext);
+        cairo_move_to(cr, padding + (j + 1) * graph_w / result->points - ext.width / 2, height - padding + ext.height + 5);
+        cairo_show_text(cr, buf);
     }
-
-    gtk_widget_queue_draw(app_data->list_drawing_area);
-    update_list_drawing_area_size(app_data);
 }
 
-static void on_list_delete_clicked(GtkWidget *widget, gpointer data) {
-    AppData *app_data = (AppData *)data;
-    if (!app_data->current_list || app_data->current_list->size == 0) return;
-
-    list_delete(app_data->current_list, 0);
-
-    GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
-    gtk_text_buffer_set_text(buffer, g_strdup_printf("Suppression de l'élément à l'index 0. Nouvelle taille: %d",
-                                                     app_data->current_list->size), -1);
+static gboolean draw_conc_bench_callback(GtkWidget *widget, cairo_t *cr, gpointer data) {
+    ConcBenchResult *result = data;
+    guint width = gtk_widget_get_allocated_width(widget);
+    guint height = gtk_widget_get_allocated_height(widget);
+    double padding = 70.0;
+    double graph_w = width - 2 * padding, graph_h = height - 2 * padding;
 
-    gtk_widget_queue_draw(app_data->list_drawing_area);
-}
+    cairo_set_source_rgb(cr, 1.0, 1.0, 1.0);
+    cairo_paint(cr);
 
-static void on_list_sort_clicked(GtkWidget *widget, gpointer data) {
-    AppData *app_data = (AppData *)data;
-    if (!app_data->current_list || !app_data->current_list->head) {
-        GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
-        gtk_text_buffer_set_text(buffer, "Erreur : La liste est vide. Veuillez créer une liste et ajouter des éléments.", -1);
-        return;
+    double max_mops = 0.001;
+    for (int j = 0; j < result->points; j++) {
+        max_mops = MAX(max_mops, MAX(result->lock_free_mops[j], result->mutex_mops[j]));
     }
+    max_mops *= 1.15;
+    draw_conc_bench_axes(cr, result, max_mops, padding, graph_w, graph_h, height);
 
-    const gchar *method_name = g_object_get_data(G_OBJECT(widget), "list-method-name");
-    if (!method_name) {
-        GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
-        gtk_text_buffer_set_text(buffer, "Erreur : Méthode de tri non identifiée.", -1);
-        return;
+    const char *labels[2] = {"Sans verrou (Harris + époques)", "Mutex global"};
+    const double *series[2] = {result->lock_free_mops, result->mutex_mops};
+    const double colors[2][3] = {{0.0, 0.7, 0.3}, {0.9, 0.3, 0.1}};
+    for (int s = 0; s < 2; s++) {
+        cairo_set_source_rgb(cr, colors[s][0], colors[s][1], colors[s][2]);
+        cairo_set_line_width(cr, 3.0);
+        for (int j = 0; j < result->points; j++) {
+            double x = padding + (j + 1) * graph_w / result->points;
+            double y = height - padding - series[s][j] / max_mops * graph_h;
+            if (j == 0) cairo_move_to(cr, x, y);
+            else cairo_line_to(cr, x, y);
+        }
+        cairo_stroke(cr);
+        for (int j = 0; j < result->points; j++) {
+            cairo_arc(cr, padding + (j + 1) * graph_w / result->points, height - padding - series[s][j] / max_mops * graph_h, 5, 0, 2 * M_PI);
+            cairo_fill(cr);
+        }
+        cairo_rectangle(cr, padding + 10, padding - 40 + s * 18, 14, 10);
+        cairo_fill(cr);
+        cairo_set_source_rgb(cr, 0.0, 0.0, 0.0);
+        cairo_set_font_size(cr, 12);
+        cairo_move_to(cr, padding + 30, padding - 30 + s * 18);
+        cairo_show_text(cr, labels[s]);
     }
+    return TRUE;
+}
 
-    // Comparer avec les noms complets incluant les emojis
-    if (g_strcmp0(method_name, "🔴 Tri à Bulles") == 0 || g_str_has_suffix(method_name, "Tri à Bulles")) {
-        list_bubble_sort(app_data->current_list);
-    } else if (g_strcmp0(method_name, "🟢 Tri par Insertion") == 0 || g_str_has_suffix(method_name, "Tri par Insertion")) {
-        list_insertion_sort(app_data->current_list);
-    } else if (g_strcmp0(method_name, "🔵 Tri Shell") == 0 || g_str_has_suffix(method_name, "Tri Shell")) {
-        list_shell_sort(app_data->current_list);
-    } else if (g_strcmp0(method_name, "🟡 Tri Quicksort") == 0 || g_str_has_suffix(method_name, "Tri Quicksort")) {
-        list_quick_sort(app_data->current_list);
-    } else {
-        GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
-        gtk_text_buffer_set_text(buffer, g_strdup_printf("Erreur : Méthode de tri non reconnue : %s", method_name), -1);
-        return;
-    }
+static void on_conc_bench_window_destroy(GtkWidget *widget, gpointer data) {
+    g_free(data);
+}
 
-    GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
-    gtk_text_buffer_set_text(buffer, g_strdup_printf("Tri de la liste effectué par : %s. (Tri par échange de données).", method_name), -1);
+// Débit en fonction du nombre de threads pour les deux variantes; la liste sans verrou de la
+// dernière mesure devient la liste courante (Liste Simple d'entiers) pour être dessinée.
+static void on_list_concurrent_benchmark_clicked(GtkWidget *widget, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    // Environ 'taille' clés présentes à l'équilibre (autant d'insertions que de suppressions)
+    int key_range = 2 * CLAMP(gtk_spin_button_get_value_as_int(app_data->list_size_input), 8, 2000);
+    int max_threads = MIN(CONC_MAX_THREADS, MAX(4, 2 * (int)g_get_num_processors()));
+
+    ConcBenchResult *result = g_new0(ConcBenchResult, 1);
+    GString *report = g_string_new(NULL);
+    g_string_append_printf(report, "Benchmark concurrent (%d clés, 20%% insertions, 20%% suppressions, 60%% recherches, %d ms par mesure):\n",
+                           key_range, CONC_RUN_MS);
+
+    ConcList *last = NULL;
+    for (int threads = 1; threads <= max_threads && result->points < 5; threads *= 2) {
+        gboolean ok_free, ok_mutex;
+        guint64 reclaimed, unused;
+        int j = result->points++;
+        result->threads[j] = threads;
+
+        ConcList *mutex_list = conc_list_new(TRUE, threads);
+        result->mutex_mops[j] = conc_run(mutex_list, threads, key_range, &ok_mutex, &unused);
+        conc_list_free(mutex_list);
+
+        if (last) conc_list_free(last);
+        last = conc_list_new(FALSE, threads);
+        result->lock_free_mops[j] = conc_run(last, threads, key_range, &ok_free, &reclaimed);
+
+        g_string_append_printf(report, "  %2d thread(s): sans verrou %.2f Mop/s | mutex %.2f Mop/s | x%.1f | %llu nœuds récupérés%s\n",
+                               threads, result->lock_free_mops[j], result->mutex_mops[j],
+                               result->lock_free_mops[j] / MAX(result->mutex_mops[j], 0.001), (unsigned long long)reclaimed,
+                               (ok_free && ok_mutex) ? "" : " ⚠️ incohérence détectée");
+    }
+
+    size_t count;
+    gboolean sorted;
+    int *keys = conc_list_keys(last, &count, &sorted);
+    conc_list_free(last);
+    List *previous = app_data->current_list;
+    app_data->current_list = list_new("Liste Simple", "Entiers (Int)");
+    list_build_from_array(app_data->current_list, keys, count);
+    list_history_record_replace(app_data->list_history, previous);
+    g_free(keys);
+    g_string_append_printf(report, "Liste finale (%lu clés triées) chargée comme liste courante.", count);
 
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
+    gtk_text_buffer_set_text(buffer, report->str, -1);
+    g_string_free(report, TRUE);
     gtk_widget_queue_draw(app_data->list_drawing_area);
+    update_list_drawing_area_size(app_data);
+
+    GtkWidget *window = gtk_window_new(GTK_WINDOW_TOPLEVEL);
+    gtk_window_set_title(GTK_WINDOW(window), "⚡ Liste Concurrente: Débit vs Threads");
+    gtk_window_set_default_size(GTK_WINDOW(window), 800, 500);
+    gtk_container_set_border_width(GTK_CONTAINER(window), 10);
+    GtkWidget *drawing_area = gtk_drawing_area_new();
+    gtk_widget_set_size_request(drawing_area, 780, 480);
+    gtk_container_add(GTK_CONTAINER(window), drawing_area);
+    g_signal_connect(drawing_area, "draw", G_CALLBACK(draw_conc_bench_callback), result);
+    g_signal_connect(window, "delete-event", G_CALLBACK(on_secondary_window_delete), NULL);
+    g_signal_connect(window, "destroy", G_CALLBACK(on_conc_bench_window_destroy), result);
+    gtk_widget_show_all(window);
 }
 
 // --- Helper for Input Dialog ---
@@ -2460,6 +6391,7 @@ static void on_list_insert_pos_clicked(GtkWidget *widget, gpointer data) {
     }
 
     list_insert_generic(app_data->current_list, val, pos);
+    list_history_record_insert(app_data->list_history, app_data->current_list, pos, 1, val);
 
     // Libérer la mémoire allouée par get_value_input
     if (g_strcmp0(element_type, "Chaîne de Caractères") == 0) {
@@ -2468,8 +6400,13 @@ static void on_list_insert_pos_clicked(GtkWidget *widget, gpointer data) {
     g_free(val);
 
     GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
-    gtk_text_buffer_set_text(buffer, g_strdup_printf("Valeur %s insérée à l'index %d. Nouvelle taille: %lu",
-                                                     value_str ? value_str : "?", pos, app_data->current_list->size), -1);
+    if (list_is_skip(app_data->current_list)) {
+        gtk_text_buffer_set_text(buffer, g_strdup_printf("Valeur %s insérée à son rang (liste à sauts triée, l'index est ignoré). Nouvelle taille: %lu",
+                                                         value_str ? value_str : "?", app_data->current_list->size), -1);
+    } else {
+        gtk_text_buffer_set_text(buffer, g_strdup_printf("Valeur %s insérée à l'index %d. Nouvelle taille: %lu",
+                                                         value_str ? value_str : "?", pos, app_data->current_list->size), -1);
+    }
     if (value_str) g_free(value_str);
 
     gtk_widget_queue_draw(app_data->list_drawing_area);
@@ -2498,6 +6435,7 @@ static void on_list_insert_start_clicked(GtkWidget *widget, gpointer data) {
     }
 
     list_insert_generic(app_data->current_list, val, 0);
+    list_history_record_insert(app_data->list_history, app_data->current_list, 0, 1, val);
 
     // Libérer la mémoire allouée par get_value_input
     if (g_strcmp0(element_type, "Chaîne de Caractères") == 0) {
@@ -2535,7 +6473,9 @@ static void on_list_insert_end_clicked(GtkWidget *widget, gpointer data) {
         value_str = g_strdup_printf("'%s'", *(const char**)val);
     }
 
-    list_insert_generic(app_data->current_list, val, app_data->current_list->size);
+    int end_index = (int)app_data->current_list->size;
+    list_insert_generic(app_data->current_list, val, end_index);
+    list_history_record_insert(app_data->list_history, app_data->current_list, end_index, 1, val);
 
     // Libérer la mémoire allouée par get_value_input
     if (g_strcmp0(element_type, "Chaîne de Caractères") == 0) {
@@ -2580,6 +6520,7 @@ static void on_list_delete_pos_clicked(GtkWidget *widget, gpointer data) {
         return;
     }
 
+    list_history_record_delete(app_data->list_history, app_data->current_list, pos, 1);
     list_delete(app_data->current_list, pos);
 
     GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
@@ -2594,6 +6535,7 @@ static void on_list_delete_start_clicked(GtkWidget *widget, gpointer data) {
     AppData *app_data = (AppData *)data;
     if (!app_data->current_list || app_data->current_list->size == 0) return;
 
+    list_history_record_delete(app_data->list_history, app_data->current_list, 0, 1);
     list_delete(app_data->current_list, 0);
 
     GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
@@ -2609,6 +6551,7 @@ static void on_list_delete_end_clicked(GtkWidget *widget, gpointer data) {
     if (!app_data->current_list || app_data->current_list->size == 0) return;
 
     size_t old_size = app_data->current_list->size;
+    list_history_record_delete(app_data->list_history, app_data->current_list, (int)app_data->current_list->size - 1, 1);
     list_delete(app_data->current_list, app_data->current_list->size - 1);
 
     GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
@@ -2619,10 +6562,193 @@ static void on_list_delete_end_clicked(GtkWidget *widget, gpointer data) {
     update_list_drawing_area_size(app_data);
 }
 
+// --- Opérations groupées: scission vers la liste secondaire, concaténation, greffe, plage ---
+
+static void on_list_split_clicked(GtkWidget *widget, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
+    if (!app_data->current_list || app_data->current_list->size == 0) {
+        gtk_text_buffer_set_text(buffer, "La liste est vide. Impossible de scinder.", -1);
+        return;
+    }
+
+    int max_pos = app_data->current_list->size;
+    gchar *prompt = g_strdup_printf("Index de scission (0-%d): les éléments suivants passent dans la liste secondaire", max_pos);
+    int pos = get_integer_input(gtk_widget_get_toplevel(widget), "Scission", prompt, max_pos / 2);
+    g_free(prompt);
+    if (pos == -1) {
+        gtk_text_buffer_set_text(buffer, "Scission annulée.", -1);
+        return;
+    }
+    pos = CLAMP(pos, 0, max_pos);
+
+    ListEdit *edit = list_history_record_delete(app_data->list_history, app_data->current_list, pos,
+                                                app_data->current_list->size - (size_t)pos);
+    gint64 start = g_get_monotonic_time();
+    List *secondary = list_split(app_data->current_list, pos);
+    double elapsed_us = (double)(g_get_monotonic_time() - start);
+    // L'étape garde l'ancienne liste secondaire: l'annulation la restaure
+    if (edit) {
+        edit->moves_secondary = TRUE;
+        edit->list = app_data->list_secondary;
+    } else if (app_data->list_secondary) {
+        list_free(app_data->list_secondary);
+    }
+    app_data->list_secondary = secondary;
+
+    gtk_text_buffer_set_text(buffer, g_strdup_printf("Liste scindée à l'index %d en %.0f µs: %lu élément(s) restent, %lu dans la liste secondaire.",
+                                                     pos, elapsed_us, app_data->current_list->size, secondary->size), -1);
+    gtk_widget_queue_draw(app_data->list_drawing_area);
+    update_list_drawing_area_size(app_data);
+}
+
+// Greffe la liste secondaire à l'index donné (index == taille: concaténation)
+static void list_splice_secondary(AppData *app_data, int pos) {
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
+    List *secondary = app_data->list_secondary;
+    size_t moved = secondary->size;
+    // Liste à sauts: les valeurs greffées sont relevées avant la fusion (voir list_history_record_insert)
+    gboolean is_string = g_strcmp0(secondary->element_type, "Chaîne de Caractères") == 0;
+    unsigned char *skip_values = list_is_skip(secondary) ? list_copy_range(secondary, 0, moved) : NULL;
+
+    gint64 start = g_get_monotonic_time();
+    if (!list_splice(app_data->current_list, pos, secondary)) {
+        list_values_free(skip_values, moved, is_string);
+        gtk_text_buffer_set_text(buffer, g_strdup_printf("Greffe impossible: la liste secondaire est une %s de %s, la liste courante une %s de %s.",
+                                                         secondary->structure_type, secondary->element_type,
+                                                         app_data->current_list->structure_type, app_data->current_list->element_type), -1);
+        return;
+    }
+    double elapsed_us = (double)(g_get_monotonic_time() - start);
+    ListEdit *edit = list_history_record_insert(app_data->list_history, app_data->current_list, pos, moved, skip_values);
+    if (edit) edit->moves_secondary = TRUE; // L'annulation reconstitue la liste secondaire
+    list_values_free(skip_values, moved, is_string);
+    list_free(secondary);
+    app_data->list_secondary = NULL;
+
+    gtk_text_buffer_set_text(buffer, g_strdup_printf("%lu élément(s) greffé(s) à l'index %d en %.0f µs. Nouvelle taille: %lu",
+                                                     moved, MIN(pos, (int)(app_data->current_list->size - moved)), elapsed_us,
+                                                     app_data->current_list->size), -1);
+    gtk_widget_queue_draw(app_data->list_drawing_area);
+    update_list_drawing_area_size(app_data);
+}
+
+static void on_list_concat_clicked(GtkWidget *widget, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    if (!app_data->list_secondary) {
+        GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
+        gtk_text_buffer_set_text(buffer, "Aucune liste secondaire: scindez d'abord la liste.", -1);
+        return;
+    }
+    if (!app_data->current_list) on_list_create_clicked(NULL, app_data);
+    if (!app_data->current_list) return;
+    list_splice_secondary(app_data, app_data->current_list->size);
+}
+
+static void on_list_splice_clicked(GtkWidget *widget, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
+    if (!app_data->list_secondary) {
+        gtk_text_buffer_set_text(buffer, "Aucune liste secondaire: scindez d'abord la liste.", -1);
+        return;
+    }
+    if (!app_data->current_list) on_list_create_clicked(NULL, app_data);
+    if (!app_data->current_list) return;
+
+    int max_pos = app_data->current_list->size;
+    gchar *prompt = g_strdup_printf("Index de greffe de la liste secondaire (0-%d):", max_pos);
+    int pos = get_integer_input(gtk_widget_get_toplevel(widget), "Greffe", prompt, 0);
+    g_free(prompt);
+    if (pos == -1) {
+        gtk_text_buffer_set_text(buffer, "Greffe annulée.", -1);
+        return;
+    }
+    list_splice_secondary(app_data, CLAMP(pos, 0, max_pos));
+}
+
+static void on_list_delete_range_clicked(GtkWidget *widget, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
+    if (!app_data->current_list || app_data->current_list->size == 0) {
+        gtk_text_buffer_set_text(buffer, "La liste est vide. Impossible de supprimer.", -1);
+        return;
+    }
+
+    int max_pos = app_data->current_list->size - 1;
+    gchar *prompt = g_strdup_printf("Premier index de la plage (0-%d):", max_pos);
+    int first = get_integer_input(gtk_widget_get_toplevel(widget), "Suppression de plage", prompt, 0);
+    g_free(prompt);
+    if (first == -1) {
+        gtk_text_buffer_set_text(buffer, "Suppression annulée.", -1);
+        return;
+    }
+    if (first < 0 || first > max_pos) {
+        gtk_text_buffer_set_text(buffer, g_strdup_printf("Index invalide! La liste contient %lu éléments (indices 0-%d).",
+                                                         app_data->current_list->size, max_pos), -1);
+        return;
+    }
+    prompt = g_strdup_printf("Nombre d'éléments à supprimer (1-%d):", max_pos - first + 1);
+    int count = get_integer_input(gtk_widget_get_toplevel(widget), "Suppression de plage", prompt, max_pos - first + 1);
+    g_free(prompt);
+    if (count <= 0) {
+        gtk_text_buffer_set_text(buffer, "Suppression annulée.", -1);
+        return;
+    }
+
+    size_t old_size = app_data->current_list->size;
+    list_history_record_delete(app_data->list_history, app_data->current_list, first, MIN((size_t)count, old_size - (size_t)first));
+    gint64 start = g_get_monotonic_time();
+    list_delete_range(app_data->current_list, first, count);
+    double elapsed_us = (double)(g_get_monotonic_time() - start);
+
+    gtk_text_buffer_set_text(buffer, g_strdup_printf("%lu élément(s) supprimé(s) à partir de l'index %d en %.0f µs. Nouvelle taille: %lu",
+                                                     old_size - app_data->current_list->size, first, elapsed_us,
+                                                     app_data->current_list->size), -1);
+    gtk_widget_queue_draw(app_data->list_drawing_area);
+    update_list_drawing_area_size(app_data);
+}
+
+// --- Historique: Annuler / Rétablir ---
+
+static void list_history_step_clicked(AppData *app_data, gboolean undo) {
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(app_data->list_info_view));
+    ListHistory *history = app_data->list_history;
+    int available = undo ? history->undo_count : history->redo_count;
+    if (available == 0) {
+        gtk_text_buffer_set_text(buffer, undo ? "Rien à annuler." : "Rien à rétablir.", -1);
+        return;
+    }
+
+    const ListEdit *edit = undo ? &history->undo[available - 1] : &history->redo[available - 1];
+    const char *description = list_edit_describe(edit);
+    gint64 start = g_get_monotonic_time();
+    gboolean applied = list_history_step(history, &app_data->current_list, &app_data->list_secondary, undo);
+    double elapsed_us = (double)(g_get_monotonic_time() - start);
+
+    if (!applied) {
+        gtk_text_buffer_set_text(buffer, "Historique incohérent: aucune liste courante.", -1);
+    } else {
+        gtk_text_buffer_set_text(buffer, g_strdup_printf("%s: %s (%.0f µs). Taille: %lu | %d étape(s) à annuler, %d à rétablir.",
+                                                         undo ? "Annulé" : "Rétabli", description, elapsed_us,
+                                                         app_data->current_list ? app_data->current_list->size : 0,
+                                                         history->undo_count, history->redo_count), -1);
+    }
+    gtk_widget_queue_draw(app_data->list_drawing_area);
+    if (app_data->current_list) update_list_drawing_area_size(app_data);
+}
+
+static void on_list_undo_clicked(GtkWidget *widget, gpointer data) {
+    list_history_step_clicked((AppData *)data, TRUE);
+}
+
+static void on_list_redo_clicked(GtkWidget *widget, gpointer data) {
+    list_history_step_clicked((AppData *)data, FALSE);
+}
+
 // --- Interactive Editing ---
 static gboolean on_list_click_event(GtkWidget *widget, GdkEventButton *event, gpointer data) {
     AppData *app_data = (AppData *)data;
-    if (!app_data->current_list || !app_data->current_list->head ||
+    if (!app_data->current_list || app_data->current_list->size == 0 ||
         event->type != GDK_BUTTON_PRESS || event->button != 1) return FALSE;
 
     // Detect node click
@@ -2640,56 +6766,73 @@ static gboolean on_list_click_event(GtkWidget *widget, GdkEventButton *event, gp
         return FALSE; // Clic sur Tête, ne rien faire
     }
 
-    // Vérifier si on clique sur "NULL" (ne pas permettre la modification de NULL)
-    int n = app_data->current_list->size;
-    double null_x = 10 + NODE_WIDTH + SPACING + n * (NODE_WIDTH + SPACING);
-    if (event->x >= null_x && event->x <= null_x + NODE_WIDTH) {
-        return FALSE; // Clic sur NULL, ne rien faire
-    }
-
-    // Chercher le nœud de données cliqué
-    // Les nœuds de données commencent après Tête: 10 + NODE_WIDTH + SPACING + i * (NODE_WIDTH + SPACING)
     int clicked_index = -1;
-    for (int i = 0; i < app_data->current_list->size; i++) {
-        double x_start = 10 + NODE_WIDTH + SPACING + i * (NODE_WIDTH + SPACING);
-        if (event->x >= x_start && event->x <= x_start + NODE_WIDTH) {
-            clicked_index = i;
-            break;
+    if (list_is_unrolled(app_data->current_list)) {
+        // Liste déroulée: cellules contiguës dans chaque bloc (voir draw_unrolled_list)
+        double x_start = 10 + NODE_WIDTH + SPACING;
+        int base_index = 0;
+        for (ListBlock *block = app_data->current_list->first_block; block; block = block->next) {
+            double cells_end = x_start + block->count * UNROLLED_CELL_WIDTH;
+            if (event->x >= x_start && event->x < cells_end) {
+                clicked_index = base_index + (int)((event->x - x_start) / UNROLLED_CELL_WIDTH);
+                break;
+            }
+            x_start += unrolled_block_width(block) + SPACING;
+            base_index += block->count;
+        }
+    } else {
+        // Pas fixe: l'emplacement se calcule directement (0 = Tête, 1..n = nœuds, n + 1 = NULL)
+        double pitch = NODE_WIDTH + SPACING;
+        double slot = floor((event->x - 10) / pitch);
+        double offset = event->x - 10 - slot * pitch;
+        if (slot < 1 || slot > (double)app_data->current_list->size || offset > NODE_WIDTH) {
+            return FALSE; // Tête, NULL ou espace entre deux nœuds: ne rien faire
         }
+        clicked_index = (int)slot - 1;
     }
 
     if (clicked_index != -1) {
-        Node *node = get_node_at(app_data->current_list, clicked_index);
-        if (node) {
+        void *value = list_value_at(app_data->current_list, clicked_index);
+        if (value) {
             const gchar *element_type = app_data->current_list->element_type;
 
             // Préparer la valeur actuelle pour l'affichage dans la boîte de dialogue
             void *current_val = NULL;
             if (g_strcmp0(element_type, "Entiers (Int)") == 0) {
-                current_val = node->data;
+                current_val = value;
             } else if (g_strcmp0(element_type, "Réels (Float)") == 0) {
-                current_val = node->data;
+                current_val = value;
             } else if (g_strcmp0(element_type, "Caractères (Char)") == 0) {
-                current_val = node->data;
+                current_val = value;
             } else if (g_strcmp0(element_type, "Chaîne de Caractères") == 0) {
-                current_val = node->data;
+                current_val = value;
             }
 
             // Demander la nouvelle valeur
             void *new_val = get_value_input(gtk_widget_get_toplevel(widget), "Modifier", "Nouvelle valeur:", element_type, current_val);
-            if (new_val) {
+            if (new_val) list_history_record_modify(app_data->list_history, app_data->current_list, clicked_index, new_val);
+            if (new_val && list_is_skip(app_data->current_list)) {
+                // Liste à sauts: la valeur détermine la position, on retire puis on réinsère
+                list_delete(app_data->current_list, clicked_index);
+                list_insert_generic(app_data->current_list, new_val, 0);
+            } else if (new_val) {
+                // L'ensemble de hachage suit la modification (ancienne valeur retirée, nouvelle ajoutée)
+                list_hash_remove(app_data->current_list, value);
+
                 // Libérer l'ancienne valeur si c'est une chaîne de caractères
                 if (g_strcmp0(element_type, "Chaîne de Caractères") == 0) {
-                    g_free(*(char **)node->data);
+                    g_free(*(char **)value);
                 }
 
                 // Copier la nouvelle valeur
                 if (g_strcmp0(element_type, "Chaîne de Caractères") == 0) {
-                    *(char **)node->data = g_strdup(*(const char **)new_val);
+                    *(char **)value = g_strdup(*(const char **)new_val);
                 } else {
-                    memcpy(node->data, new_val, app_data->current_list->element_size);
+                    memcpy(value, new_val, app_data->current_list->element_size);
                 }
-
+                list_hash_add(app_data->current_list, value);
+            }
+            if (new_val) {
                 // Libérer la mémoire allouée par get_value_input
                 if (g_strcmp0(element_type, "Chaîne de Caractères") == 0) {
                     g_free(*(char **)new_val);
@@ -2725,6 +6868,7 @@ static gboolean on_list_click_event(GtkWidget *widget, GdkEventButton *event, gp
 static void create_list_window(GtkWidget *parent_window) {
     AppData *app_data = g_new0(AppData, 1);
     app_data->current_list = NULL;
+    app_data->list_history = g_new0(ListHistory, 1);
 
     GtkWidget *window = gtk_window_new(GTK_WINDOW_TOPLEVEL);
     gtk_window_set_title(GTK_WINDOW(window), "🔗 Module Listes Chaînées (Opérations et Tri)");
@@ -2783,6 +6927,8 @@ static void create_list_window(GtkWidget *parent_window) {
     GtkWidget *list_type_combo = gtk_combo_box_text_new();
     gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(list_type_combo), "Liste Simple");
     gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(list_type_combo), "Liste Double");
+    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(list_type_combo), "Liste Déroulée");
+    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(list_type_combo), "Liste à Sauts");
     gtk_combo_box_set_active(GTK_COMBO_BOX(list_type_combo), 0);
     // Style CSS activé
     gtk_style_context_add_class(gtk_widget_get_style_context(list_type_combo), "modern-combo");
@@ -2851,7 +6997,7 @@ static void create_list_window(GtkWidget *parent_window) {
     gtk_box_pack_start(GTK_BOX(random_box), size_hbox, FALSE, FALSE, 0);
     GtkWidget *lbl_size = gtk_label_new("Taille:");
     gtk_box_pack_start(GTK_BOX(size_hbox), lbl_size, FALSE, FALSE, 0);
-    GtkWidget *spin_size = gtk_spin_button_new_with_range(1, 10000, 1);
+    GtkWidget *spin_size = gtk_spin_button_new_with_range(1, MAX_LIST_SIZE, 1);
     gtk_spin_button_set_value(GTK_SPIN_BUTTON(spin_size), 10);
     // Style CSS activé
     gtk_style_context_add_class(gtk_widget_get_style_context(spin_size), "modern-spin");
@@ -2870,7 +7016,7 @@ static void create_list_window(GtkWidget *parent_window) {
     app_data->list_manual_box = manual_box;
 
     GtkWidget *entry_val = gtk_entry_new();
-    gtk_entry_set_placeholder_text(GTK_ENTRY(entry_val), "Valeur (entier)");
+    gtk_entry_set_placeholder_text(GTK_ENTRY(entry_val), "Valeurs (ex: 4, 8, 15)");
     // Style CSS activé
     gtk_style_context_add_class(gtk_widget_get_style_context(entry_val), "modern-combo");
     gtk_box_pack_start(GTK_BOX(manual_box), entry_val, FALSE, FALSE, 0);
@@ -2889,6 +7035,24 @@ static void create_list_window(GtkWidget *parent_window) {
     gtk_style_context_add_class(gtk_widget_get_style_context(ops_card), "modern-card");
     gtk_box_pack_start(GTK_BOX(control_vbox), ops_card, TRUE, TRUE, 0);
 
+    // --- Historique (Annuler / Rétablir)
+    GtkWidget *grid_history = gtk_grid_new();
+    gtk_grid_set_column_spacing(GTK_GRID(grid_history), 8);
+    gtk_grid_set_column_homogeneous(GTK_GRID(grid_history), TRUE);
+    gtk_box_pack_start(GTK_BOX(ops_card), grid_history, FALSE, FALSE, 0);
+
+    GtkWidget *btn_undo = gtk_button_new_with_label("↩️ Annuler");
+    // Style CSS activé
+    gtk_style_context_add_class(gtk_widget_get_style_context(btn_undo), "modern-button");
+    g_signal_connect(btn_undo, "clicked", G_CALLBACK(on_list_undo_clicked), app_data);
+    gtk_grid_attach(GTK_GRID(grid_history), btn_undo, 0, 0, 1, 1);
+
+    GtkWidget *btn_redo = gtk_button_new_with_label("↪️ Rétablir");
+    // Style CSS activé
+    gtk_style_context_add_class(gtk_widget_get_style_context(btn_redo), "modern-button");
+    g_signal_connect(btn_redo, "clicked", G_CALLBACK(on_list_redo_clicked), app_data);
+    gtk_grid_attach(GTK_GRID(grid_history), btn_redo, 1, 0, 1, 1);
+
     // --- Opérations Avancées (Insertion)
     GtkWidget *label_ins = gtk_label_new("Insertion");
     gtk_label_set_markup(GTK_LABEL(label_ins), "<span foreground='#ffffff' size='large' weight='bold'>➕ Insertion</span>");
@@ -2947,6 +7111,41 @@ static void create_list_window(GtkWidget *parent_window) {
     g_signal_connect(btn_del_pos, "clicked", G_CALLBACK(on_list_delete_pos_clicked), app_data);
     gtk_grid_attach(GTK_GRID(grid_del), btn_del_pos, 2, 0, 1, 1);
 
+    // --- Opérations Groupées (liste secondaire)
+    GtkWidget *label_bulk = gtk_label_new("Opérations groupées");
+    gtk_label_set_markup(GTK_LABEL(label_bulk), "<span foreground='#ffffff' size='large' weight='bold'>🧩 Opérations groupées</span>");
+    gtk_box_pack_start(GTK_BOX(ops_card), label_bulk, FALSE, FALSE, 10);
+
+    GtkWidget *grid_bulk = gtk_grid_new();
+    gtk_grid_set_column_spacing(GTK_GRID(grid_bulk), 8);
+    gtk_grid_set_row_spacing(GTK_GRID(grid_bulk), 8);
+    gtk_grid_set_column_homogeneous(GTK_GRID(grid_bulk), TRUE);
+    gtk_box_pack_start(GTK_BOX(ops_card), grid_bulk, FALSE, FALSE, 0);
+
+    GtkWidget *btn_split = gtk_button_new_with_label("✂️ Scinder");
+    // Style CSS activé
+    gtk_style_context_add_class(gtk_widget_get_style_context(btn_split), "modern-button");
+    g_signal_connect(btn_split, "clicked", G_CALLBACK(on_list_split_clicked), app_data);
+    gtk_grid_attach(GTK_GRID(grid_bulk), btn_split, 0, 0, 1, 1);
+
+    GtkWidget *btn_concat = gtk_button_new_with_label("🔗 Concaténer");
+    // Style CSS activé
+    gtk_style_context_add_class(gtk_widget_get_style_context(btn_concat), "modern-button");
+    g_signal_connect(btn_concat, "clicked", G_CALLBACK(on_list_concat_clicked), app_data);
+    gtk_grid_attach(GTK_GRID(grid_bulk), btn_concat, 1, 0, 1, 1);
+
+    GtkWidget *btn_splice = gtk_button_new_with_label("📌 Greffer...");
+    // Style CSS activé
+    gtk_style_context_add_class(gtk_widget_get_style_context(btn_splice), "modern-button");
+    g_signal_connect(btn_splice, "clicked", G_CALLBACK(on_list_splice_clicked), app_data);
+    gtk_grid_attach(GTK_GRID(grid_bulk), btn_splice, 0, 1, 1, 1);
+
+    GtkWidget *btn_del_range = gtk_button_new_with_label("🗑️ Plage...");
+    // Style CSS activé
+    gtk_style_context_add_class(gtk_widget_get_style_context(btn_del_range), "modern-button");
+    g_signal_connect(btn_del_range, "clicked", G_CALLBACK(on_list_delete_range_clicked), app_data);
+    gtk_grid_attach(GTK_GRID(grid_bulk), btn_del_range, 1, 1, 1, 1);
+
     // Initial state
     gtk_widget_hide(manual_box); // Start with Random shown
 
@@ -2963,9 +7162,9 @@ static void create_list_window(GtkWidget *parent_window) {
     GtkWidget *sort_vbox = gtk_box_new(GTK_ORIENTATION_VERTICAL, 8);
     gtk_box_pack_start(GTK_BOX(sort_card), sort_vbox, FALSE, FALSE, 0);
 
-    // Les 4 tris demandés
-    const gchar *LIST_METHOD_NAMES[] = {"🔴 Tri à Bulles", "🟢 Tri par Insertion", "🔵 Tri Shell", "🟡 Tri Quicksort"};
-    for (int i = 0; i < 4; i++) {
+    // Les 4 tris demandés + tri fusion ascendant (O(n log n), rechaînement des nœuds)
+    const gchar *LIST_METHOD_NAMES[] = {"🔴 Tri à Bulles", "🟢 Tri par Insertion", "🔵 Tri Shell", "🟡 Tri Quicksort", "🟣 Tri Fusion"};
+    for (int i = 0; i < 5; i++) {
         GtkWidget *btn = gtk_button_new_with_label(LIST_METHOD_NAMES[i]);
         g_object_set_data(G_OBJECT(btn), "list-method-name", (gpointer)LIST_METHOD_NAMES[i]);
         // Style CSS activé
@@ -2974,6 +7173,30 @@ static void create_list_window(GtkWidget *parent_window) {
         gtk_box_pack_start(GTK_BOX(sort_vbox), btn, FALSE, FALSE, 0);
     }
 
+    // Balayage: chaque bouton de tri mesure plusieurs tailles et trace liste vs tableau
+    GtkWidget *sweep_toggle = gtk_check_button_new_with_label("Balayage de tailles (liste vs tableau)");
+    gtk_box_pack_start(GTK_BOX(sort_vbox), sweep_toggle, FALSE, FALSE, 0);
+    app_data->list_sweep_toggle = sweep_toggle;
+
+    // Comparaison des structures (taille prise dans "Taille")
+    GtkWidget *locality_btn = gtk_button_new_with_label("⏱️ Benchmark Localité");
+    // Style CSS activé
+    gtk_style_context_add_class(gtk_widget_get_style_context(locality_btn), "modern-button");
+    g_signal_connect(locality_btn, "clicked", G_CALLBACK(on_list_locality_benchmark_clicked), app_data);
+    gtk_box_pack_start(GTK_BOX(sort_vbox), locality_btn, FALSE, FALSE, 0);
+
+    GtkWidget *access_btn = gtk_button_new_with_label("⏱️ Benchmark Accès par Index");
+    // Style CSS activé
+    gtk_style_context_add_class(gtk_widget_get_style_context(access_btn), "modern-button");
+    g_signal_connect(access_btn, "clicked", G_CALLBACK(on_list_access_benchmark_clicked), app_data);
+    gtk_box_pack_start(GTK_BOX(sort_vbox), access_btn, FALSE, FALSE, 0);
+
+    GtkWidget *concurrent_btn = gtk_button_new_with_label("⚡ Benchmark Concurrent (threads)");
+    // Style CSS activé
+    gtk_style_context_add_class(gtk_widget_get_style_context(concurrent_btn), "modern-button");
+    g_signal_connect(concurrent_btn, "clicked", G_CALLBACK(on_list_concurrent_benchmark_clicked), app_data);
+    gtk_box_pack_start(GTK_BOX(sort_vbox), concurrent_btn, FALSE, FALSE, 0);
+
     gtk_box_pack_start(GTK_BOX(main_hbox), control_scrolled, FALSE, FALSE, 0);
 
 
@@ -4883,91 +9106,440 @@ static void create_graph_window(GtkWidget *parent_window) {
     // Gestionnaire pour la fermeture de la fenêtre secondaire
     g_signal_connect(window, "delete-event", G_CALLBACK(on_secondary_window_delete), NULL);
 
-    gtk_widget_show_all(window);
+    gtk_widget_show_all(window);
+}
+
+
+// --- Gestion Mémoire ---
+// Libération par rotations: le fils gauche est remonté jusqu'à ce que le nœud courant
+// n'en ait plus, puis il est libéré. O(n) sans pile ni récursion.
+static void free_binary_tree(BinaryNode *root) {
+    while (root) {
+        if (root->left) {
+            BinaryNode *left = root->left;
+            root->left = left->right;
+            left->right = root;
+            root = left;
+        } else {
+            BinaryNode *next = root->right;
+            free(root->data); // Assume data ptr
+            free(root);
+            root = next;
+        }
+    }
+}
+
+// Même principe sur la représentation fils gauche / frère droit (frères de root inclus)
+static void free_nary_tree(NaryNode *root) {
+    while (root) {
+        if (root->first_child) {
+            NaryNode *child = root->first_child;
+            root->first_child = child->next_sibling;
+            child->next_sibling = root;
+            root = child;
+        } else {
+            NaryNode *next = root->next_sibling;
+            free(root->data);
+            free(root);
+            root = next;
+        }
+    }
+}
+
+// --- Champs augmentés: taille et hauteur de chaque sous-arbre ---
+// Tenus à jour par les insertions, suppressions et rotations: taille et hauteur de
+// l'arbre en O(1), k-ième valeur et rang en O(hauteur), soit O(log n) une fois équilibré.
+static int binary_node_size(BinaryNode *node) {
+    return node ? node->size : 0;
+}
+
+static int binary_node_height(BinaryNode *node) {
+    return node ? node->height : 0;
+}
+
+// Recalcule les champs d'un nœud à partir de ceux (à jour) de ses enfants
+static void binary_node_update(BinaryNode *node) {
+    int l = binary_node_height(node->left);
+    int r = binary_node_height(node->right);
+    node->height = 1 + (l > r ? l : r);
+    node->size = 1 + binary_node_size(node->left) + binary_node_size(node->right);
+}
+
+// Remonte un chemin mémorisé depuis la racine (le nœud le plus profond est au sommet)
+static void binary_update_path(TreeStack *path) {
+    while (path->count) binary_node_update(tree_stack_pop(path));
+    tree_stack_free(path);
+}
+
+static BinaryNode *binary_node_new(void *data, size_t element_size) {
+    BinaryNode *new_node = g_new0(BinaryNode, 1);
+    new_node->data = malloc(element_size);
+    memcpy(new_node->data, data, element_size);
+    new_node->size = 1;
+    new_node->height = 1;
+    return new_node;
+}
+
+// Taille et hauteur de tous les nœuds d'un arbre construit sans elles (post-ordre)
+static void binary_annotate(BinaryNode *root) {
+    TreeStack stack = {0};
+    BinaryNode *node = root;
+    BinaryNode *last_visited = NULL;
+    while (node || stack.count) {
+        while (node) {
+            tree_stack_push(&stack, node);
+            node = node->left;
+        }
+        BinaryNode *top = stack.items[stack.count - 1];
+        if (top->right && top->right != last_visited) {
+            node = top->right;
+        } else {
+            binary_node_update(top);
+            last_visited = tree_stack_pop(&stack);
+        }
+    }
+    tree_stack_free(&stack);
+}
+
+// --- Insertion Binaire (BST) ---
+static BinaryNode *insert_binary(BinaryNode *node, void *data, int (*compare_func)(const void *, const void *), size_t element_size) {
+    TreeStack path = {0};
+    BinaryNode **link = &node;
+    while (*link) {
+        int c = compare_func(data, (*link)->data);
+        if (c == 0) { // Doublon ignoré
+            tree_stack_free(&path);
+            return node;
+        }
+        tree_stack_push(&path, *link);
+        link = c < 0 ? &(*link)->left : &(*link)->right;
+    }
+
+    *link = binary_node_new(data, element_size);
+    binary_update_path(&path);
+    return node;
+}
+
+// --- Arbres binaires équilibrés (AVL / Rouge-Noir) ---
+// Mêmes règles que insert_binary (doublons ignorés), mais des rotations après chaque
+// insertion ou suppression bornent la profondeur à O(log n), même sur une saisie triée.
+// La récursion y reste donc courte (moins de 60 appels pour un million de nœuds).
+static BinaryNode *avl_rotate_right(BinaryNode *node) {
+    BinaryNode *pivot = node->left;
+    node->left = pivot->right;
+    pivot->right = node;
+    binary_node_update(node);
+    binary_node_update(pivot);
+    return pivot;
+}
+
+static BinaryNode *avl_rotate_left(BinaryNode *node) {
+    BinaryNode *pivot = node->right;
+    node->right = pivot->left;
+    pivot->left = node;
+    binary_node_update(node);
+    binary_node_update(pivot);
+    return pivot;
+}
+
+// Rétablit |h(gauche) - h(droit)| <= 1 au nœud: rotation simple ou double
+static BinaryNode *avl_rebalance(BinaryNode *node) {
+    binary_node_update(node);
+    int balance = binary_node_height(node->left) - binary_node_height(node->right);
+    if (balance > 1) {
+        if (binary_node_height(node->left->left) < binary_node_height(node->left->right)) {
+            node->left = avl_rotate_left(node->left);
+        }
+        return avl_rotate_right(node);
+    }
+    if (balance < -1) {
+        if (binary_node_height(node->right->right) < binary_node_height(node->right->left)) {
+            node->right = avl_rotate_right(node->right);
+        }
+        return avl_rotate_left(node);
+    }
+    return node;
+}
+
+static BinaryNode *insert_avl(BinaryNode *node, void *data, int (*compare_func)(const void *, const void *), size_t element_size) {
+    if (node == NULL) return binary_node_new(data, element_size);
+
+    int c = compare_func(data, node->data);
+    if (c < 0) node->left = insert_avl(node->left, data, compare_func, element_size);
+    else if (c > 0) node->right = insert_avl(node->right, data, compare_func, element_size);
+    else return node; // Doublon: hauteurs inchangées
+    return avl_rebalance(node);
+}
+
+static BinaryNode *delete_avl(BinaryNode *root, int val) {
+    if (!root) return NULL;
+
+    int root_val = *(int*)root->data;
+    if (val < root_val) root->left = delete_avl(root->left, val);
+    else if (val > root_val) root->right = delete_avl(root->right, val);
+    else {
+        if (!root->left || !root->right) {
+            BinaryNode *temp = root->left ? root->left : root->right;
+            free(root->data); free(root);
+            return temp;
+        }
+        BinaryNode *succ = root->right;
+        while (succ->left) succ = succ->left;
+        *(int*)root->data = *(int*)succ->data;
+        root->right = delete_avl(root->right, *(int*)succ->data);
+    }
+    return avl_rebalance(root);
+}
+
+// Rouge-Noir penché à gauche (Sedgewick): un nœud rouge est toujours un fils gauche,
+// ce qui évite le pointeur parent et réduit les cas de recoloration.
+static gboolean rb_is_red(BinaryNode *node) {
+    return node && node->red;
+}
+
+static BinaryNode *rb_rotate_left(BinaryNode *node) {
+    BinaryNode *pivot = node->right;
+    node->right = pivot->left;
+    pivot->left = node;
+    pivot->red = node->red;
+    node->red = TRUE;
+    binary_node_update(node);
+    binary_node_update(pivot);
+    return pivot;
 }
 
+static BinaryNode *rb_rotate_right(BinaryNode *node) {
+    BinaryNode *pivot = node->left;
+    node->left = pivot->right;
+    pivot->right = node;
+    pivot->red = node->red;
+    node->red = TRUE;
+    binary_node_update(node);
+    binary_node_update(pivot);
+    return pivot;
+}
 
-// --- Gestion Mémoire ---
-static void free_binary_tree(BinaryNode *root) {
-    if (!root) return;
-    free_binary_tree(root->left);
-    free_binary_tree(root->right);
-    free(root->data); // Assume data ptr
-    free(root);
+static void rb_flip_colors(BinaryNode *node) {
+    node->red = !node->red;
+    node->left->red = !node->left->red;
+    node->right->red = !node->right->red;
 }
 
-static void free_nary_tree(NaryNode *root) {
-    if (!root) return;
-    free_nary_tree(root->first_child);
-    free_nary_tree(root->next_sibling);
-    free(root->data);
-    free(root);
+// Remontée: lien rouge à droite -> rotation gauche, deux rouges à gauche -> rotation droite,
+// deux fils rouges -> éclatement (le rouge remonte vers le parent)
+static BinaryNode *rb_fix_up(BinaryNode *node) {
+    binary_node_update(node); // Enfants éventuellement modifiés par l'appelant
+    if (rb_is_red(node->right) && !rb_is_red(node->left)) node = rb_rotate_left(node);
+    if (rb_is_red(node->left) && rb_is_red(node->left->left)) node = rb_rotate_right(node);
+    if (rb_is_red(node->left) && rb_is_red(node->right)) rb_flip_colors(node);
+    return node;
 }
 
-// --- Insertion Binaire (BST) ---
-static BinaryNode *insert_binary(BinaryNode *node, void *data, int (*compare_func)(const void *, const void *), size_t element_size) {
+static BinaryNode *rb_insert_node(BinaryNode *node, void *data, int (*compare_func)(const void *, const void *), size_t element_size) {
     if (node == NULL) {
-        BinaryNode *new_node = g_new0(BinaryNode, 1);
-        new_node->data = malloc(element_size);
-        memcpy(new_node->data, data, element_size);
+        BinaryNode *new_node = binary_node_new(data, element_size);
+        new_node->red = TRUE;
         return new_node;
     }
 
-    if (compare_func(data, node->data) < 0) {
-        node->left = insert_binary(node->left, data, compare_func, element_size);
-    } else if (compare_func(data, node->data) > 0) {
-        node->right = insert_binary(node->right, data, compare_func, element_size);
+    int c = compare_func(data, node->data);
+    if (c < 0) node->left = rb_insert_node(node->left, data, compare_func, element_size);
+    else if (c > 0) node->right = rb_insert_node(node->right, data, compare_func, element_size);
+    return rb_fix_up(node);
+}
+
+static BinaryNode *insert_rb(BinaryNode *root, void *data, int (*compare_func)(const void *, const void *), size_t element_size) {
+    root = rb_insert_node(root, data, compare_func, element_size);
+    root->red = FALSE;
+    return root;
+}
+
+// Descente de suppression: garantit que le nœud courant ou son fils gauche est rouge
+static BinaryNode *rb_move_red_left(BinaryNode *node) {
+    rb_flip_colors(node);
+    if (rb_is_red(node->right->left)) {
+        node->right = rb_rotate_right(node->right);
+        node = rb_rotate_left(node);
+        rb_flip_colors(node);
+    }
+    return node;
+}
+
+static BinaryNode *rb_move_red_right(BinaryNode *node) {
+    rb_flip_colors(node);
+    if (rb_is_red(node->left->left)) {
+        node = rb_rotate_right(node);
+        rb_flip_colors(node);
     }
     return node;
 }
 
+static BinaryNode *rb_delete_min(BinaryNode *node) {
+    if (!node->left) {
+        free(node->data); free(node);
+        return NULL;
+    }
+    if (!rb_is_red(node->left) && !rb_is_red(node->left->left)) node = rb_move_red_left(node);
+    node->left = rb_delete_min(node->left);
+    return rb_fix_up(node);
+}
+
+// Précondition: val est présente dans le sous-arbre
+static BinaryNode *rb_delete_node(BinaryNode *node, int val) {
+    if (val < *(int*)node->data) {
+        if (!rb_is_red(node->left) && !rb_is_red(node->left->left)) node = rb_move_red_left(node);
+        node->left = rb_delete_node(node->left, val);
+    } else {
+        if (rb_is_red(node->left)) node = rb_rotate_right(node);
+        if (val == *(int*)node->data && !node->right) {
+            free(node->data); free(node);
+            return NULL;
+        }
+        if (!rb_is_red(node->right) && !rb_is_red(node->right->left)) node = rb_move_red_right(node);
+        if (val == *(int*)node->data) {
+            BinaryNode *succ = node->right;
+            while (succ->left) succ = succ->left;
+            *(int*)node->data = *(int*)succ->data;
+            node->right = rb_delete_min(node->right);
+        } else {
+            node->right = rb_delete_node(node->right, val);
+        }
+    }
+    return rb_fix_up(node);
+}
+
+static BinaryNode *delete_rb(BinaryNode *root, int val) {
+    // La descente restructure l'arbre: ne la lancer que si la valeur existe
+    BinaryNode *probe = root;
+    while (probe && *(int*)probe->data != val) {
+        probe = val < *(int*)probe->data ? probe->left : probe->right;
+    }
+    if (!probe) return root;
+
+    if (!rb_is_red(root->left) && !rb_is_red(root->right)) root->red = TRUE;
+    root = rb_delete_node(root, val);
+    if (root) root->red = FALSE;
+    return root;
+}
+
+// Points d'entrée selon l'équilibrage choisi
+static BinaryNode *insert_binary_balanced(BinaryNode *root, void *data, int (*compare_func)(const void *, const void *), size_t element_size, TreeBalance balance) {
+    switch (balance) {
+        case TREE_BALANCE_AVL: return insert_avl(root, data, compare_func, element_size);
+        case TREE_BALANCE_RB: return insert_rb(root, data, compare_func, element_size);
+        default: return insert_binary(root, data, compare_func, element_size);
+    }
+}
+
+// Hauteur noire: nombre de nœuds noirs sur le chemin le plus à gauche (identique pour tous)
+static int rb_black_height(BinaryNode *root) {
+    int h = 0;
+    for (BinaryNode *node = root; node; node = node->left) {
+        if (!node->red) h++;
+    }
+    return h;
+}
+
+// Réinsère les valeurs d'un arbre dans un autre (changement d'équilibrage), en pré-ordre
+static void binary_reinsert_all(BinaryNode *src, BinaryNode **dst, TreeBalance balance) {
+    TreeStack stack = {0};
+    if (src) tree_stack_push(&stack, src);
+    while (stack.count) {
+        BinaryNode *node = tree_stack_pop(&stack);
+        *dst = insert_binary_balanced(*dst, node->data, compare_int, sizeof(int), balance);
+        if (node->right) tree_stack_push(&stack, node->right);
+        if (node->left) tree_stack_push(&stack, node->left);
+    }
+    tree_stack_free(&stack);
+}
+
 // --- Insertion N-Ary (Random Child) ---
-static NaryNode *insert_nary_random(NaryNode *root, void *data, size_t element_size, int max_children) {
-    // Création de la racine si nécessaire
+static NaryNode *nary_node_new(void *data, size_t element_size) {
+    NaryNode *node = g_new0(NaryNode, 1);
+    node->data = malloc(element_size);
+    memcpy(node->data, data, element_size);
+    return node;
+}
+
+static void nary_append_child(NaryNode *parent, NaryNode *child) {
+    if (parent->last_child) parent->last_child->next_sibling = child;
+    else parent->first_child = child;
+    parent->last_child = child;
+    parent->child_count++;
+}
+
+static void nary_frontier_invalidate(NaryFrontier *frontier) {
+    frontier->valid = FALSE;
+}
+
+static void nary_frontier_free(NaryFrontier *frontier) {
+    tree_stack_free(&frontier->nodes);
+    frontier->head = 0;
+    frontier->valid = FALSE;
+}
+
+// Parcours en largeur complet: seulement après une suppression ou un changement de degré
+static void nary_frontier_rebuild(NaryFrontier *frontier, NaryNode *root, int max_children) {
+    frontier->nodes.count = 0;
+    frontier->head = 0;
+    frontier->degree = max_children;
+    frontier->valid = TRUE;
+
+    TreeStack queue = {0};
+    tree_stack_push(&queue, root);
+    for (size_t i = 0; i < queue.count; i++) {
+        NaryNode *node = queue.items[i];
+        if (node->child_count < max_children) tree_stack_push(&frontier->nodes, node);
+        for (NaryNode *child = node->first_child; child; child = child->next_sibling) {
+            tree_stack_push(&queue, child);
+        }
+    }
+    tree_stack_free(&queue);
+}
+
+// Insertion sous le premier nœud (en largeur) qui a encore de la place: O(1) amorti
+static NaryNode *insert_nary_random(NaryNode *root, NaryFrontier *frontier, void *data, size_t element_size, int max_children) {
+    NaryNode *new_node = nary_node_new(data, element_size);
+
+    // Création de la racine si nécessaire: la file repart de zéro
     if (root == NULL) {
-        NaryNode *new_node = g_new0(NaryNode, 1);
-        new_node->data = malloc(element_size);
-        memcpy(new_node->data, data, element_size);
+        frontier->nodes.count = 0;
+        frontier->head = 0;
+        frontier->degree = max_children;
+        frontier->valid = TRUE;
+        tree_stack_push(&frontier->nodes, new_node);
         return new_node;
     }
 
-    // Si un degré max est défini (>0), on cherche un parent qui a de la place
+    // Si un degré max est défini (>0), on prend le parent en tête de file
     if (max_children > 0) {
-        GQueue queue = G_QUEUE_INIT;
-        g_queue_push_tail(&queue, root);
-
-        while (!g_queue_is_empty(&queue)) {
-            NaryNode *parent = g_queue_pop_head(&queue);
-
-            // Compter les enfants existants et remplir la file pour la suite
-            int child_count = 0;
-            NaryNode *child_iter = parent->first_child;
-            while (child_iter) {
-                child_count++;
-                g_queue_push_tail(&queue, child_iter);
-                child_iter = child_iter->next_sibling;
+        if (!frontier->valid || frontier->degree != max_children) {
+            nary_frontier_rebuild(frontier, root, max_children);
+        }
+        while (frontier->head < frontier->nodes.count) {
+            NaryNode *parent = frontier->nodes.items[frontier->head];
+            if (parent->child_count >= max_children) {
+                frontier->head++; // Saturé: ne reviendra plus en tête
+                continue;
             }
 
-            // Parent trouvé : on peut ajouter ici
-            if (child_count < max_children) {
-                NaryNode *new_node = g_new0(NaryNode, 1);
-                new_node->data = malloc(element_size);
-                memcpy(new_node->data, data, element_size);
+            nary_append_child(parent, new_node);
+            if (parent->child_count >= max_children) frontier->head++;
+            tree_stack_push(&frontier->nodes, new_node); // Une feuille a toujours de la place
 
-                if (parent->first_child == NULL) {
-                    parent->first_child = new_node;
-                } else {
-                    NaryNode *last = parent->first_child;
-                    while (last->next_sibling) last = last->next_sibling;
-                    last->next_sibling = new_node;
-                }
-                return root;
+            // Compacter quand plus de la moitié du tableau est déjà consommée
+            if (frontier->head >= 64 && frontier->head * 2 > frontier->nodes.count) {
+                frontier->nodes.count -= frontier->head;
+                memmove(frontier->nodes.items, frontier->nodes.items + frontier->head,
+                        frontier->nodes.count * sizeof(void *));
+                frontier->head = 0;
             }
+            return root;
         }
         // Si aucun parent n'a de place (arbre saturé), on retombe sur l'ancien mode non borné
     }
 
-    // Mode non borné : ancien comportement "aléatoire"
+    // Mode non borné : ancien comportement "aléatoire" (la file ne suit plus l'arbre)
     NaryNode *current = root;
     while (current->first_child && (rand() % 2 == 0)) {
         current = current->first_child;
@@ -4975,85 +9547,139 @@ static NaryNode *insert_nary_random(NaryNode *root, void *data, size_t element_s
             current = current->next_sibling;
         }
     }
-
-    NaryNode *new_node = g_new0(NaryNode, 1);
-    new_node->data = malloc(element_size);
-    memcpy(new_node->data, data, element_size);
-
-    if (current->first_child == NULL) {
-        current->first_child = new_node;
-    } else {
-        NaryNode *child = current->first_child;
-        while (child->next_sibling) child = child->next_sibling;
-        child->next_sibling = new_node;
-    }
+    nary_append_child(current, new_node);
+    nary_frontier_invalidate(frontier);
     return root;
 }
 
 // --- Parcours (Traversals) ---
-static void preorder_binary(BinaryNode *root, GString *str, const gchar *type) {
-    if (!root) return;
-    // Print stats/data
-    if (g_strcmp0(type, "Entiers (Int)") == 0) g_string_append_printf(str, "%d ", *(int*)root->data);
+static void append_tree_value(GString *str, void *data, const gchar *type) {
+    if (g_strcmp0(type, "Entiers (Int)") == 0) g_string_append_printf(str, "%d ", *(int*)data);
     else g_string_append_printf(str, "? ");
+}
 
-    preorder_binary(root->left, str, type);
-    preorder_binary(root->right, str, type);
+static void preorder_binary(BinaryNode *root, GString *str, const gchar *type) {
+    TreeStack stack = {0};
+    if (root) tree_stack_push(&stack, root);
+    while (stack.count) {
+        BinaryNode *node = tree_stack_pop(&stack);
+        append_tree_value(str, node->data, type);
+        // Droit empilé d'abord pour que le gauche sorte en premier
+        if (node->right) tree_stack_push(&stack, node->right);
+        if (node->left) tree_stack_push(&stack, node->left);
+    }
+    tree_stack_free(&stack);
 }
 
 static void inorder_binary(BinaryNode *root, GString *str, const gchar *type) {
-    if (!root) return;
-    inorder_binary(root->left, str, type);
-    if (g_strcmp0(type, "Entiers (Int)") == 0) g_string_append_printf(str, "%d ", *(int*)root->data);
-    else g_string_append_printf(str, "? ");
-    inorder_binary(root->right, str, type);
+    TreeStack stack = {0};
+    BinaryNode *node = root;
+    while (node || stack.count) {
+        while (node) {
+            tree_stack_push(&stack, node);
+            node = node->left;
+        }
+        node = tree_stack_pop(&stack);
+        append_tree_value(str, node->data, type);
+        node = node->right;
+    }
+    tree_stack_free(&stack);
 }
 
 static void postorder_binary(BinaryNode *root, GString *str, const gchar *type) {
-    if (!root) return;
-    postorder_binary(root->left, str, type);
-    postorder_binary(root->right, str, type);
-    if (g_strcmp0(type, "Entiers (Int)") == 0) g_string_append_printf(str, "%d ", *(int*)root->data);
-    else g_string_append_printf(str, "? ");
+    TreeStack stack = {0};
+    BinaryNode *node = root;
+    BinaryNode *last_visited = NULL;
+    while (node || stack.count) {
+        while (node) {
+            tree_stack_push(&stack, node);
+            node = node->left;
+        }
+        BinaryNode *top = stack.items[stack.count - 1];
+        if (top->right && top->right != last_visited) {
+            // Sous-arbre droit pas encore parcouru
+            node = top->right;
+        } else {
+            append_tree_value(str, top->data, type);
+            last_visited = tree_stack_pop(&stack);
+        }
+    }
+    tree_stack_free(&stack);
 }
 
 // --- Stats ---
+// O(1) grâce aux champs augmentés de la racine
 static int binary_depth(BinaryNode *root) {
-    if (!root) return 0;
-    int l = binary_depth(root->left);
-    int r = binary_depth(root->right);
-    return 1 + (l > r ? l : r);
+    return binary_node_height(root);
 }
 
 static int binary_size(BinaryNode *root) {
-    if (!root) return 0;
-    return 1 + binary_size(root->left) + binary_size(root->right);
+    return binary_node_size(root);
+}
+
+// --- Statistiques d'ordre (arbre binaire de recherche augmenté) ---
+// k-ième plus petite valeur (k à partir de 1), NULL si k est hors de [1, n]
+static BinaryNode *binary_select(BinaryNode *root, int k) {
+    BinaryNode *node = root;
+    while (node) {
+        int left_size = binary_node_size(node->left);
+        if (k <= left_size) {
+            node = node->left;
+        } else if (k == left_size + 1) {
+            return node;
+        } else {
+            k -= left_size + 1;
+            node = node->right;
+        }
+    }
+    return NULL;
+}
+
+// Nombre de valeurs < val (ou <= val si inclusive): chaque pas à droite compte le
+// sous-arbre gauche et le nœud quittés
+static int binary_count_below(BinaryNode *root, int val, gboolean inclusive) {
+    int count = 0;
+    BinaryNode *node = root;
+    while (node) {
+        int v = *(int*)node->data;
+        if (v < val || (inclusive && v == val)) {
+            count += binary_node_size(node->left) + 1;
+            node = node->right;
+        } else {
+            node = node->left;
+        }
+    }
+    return count;
 }
 
 // --- Parcours pour N-Aire ---
+// Sur la représentation fils gauche / frère droit, le pré-ordre N-aire est le pré-ordre
+// binaire et le post-ordre N-aire l'in-ordre binaire; les frères de root sont exclus.
 static void preorder_nary(NaryNode *root, GString *str, const gchar *type) {
-    if (!root) return;
-    if (g_strcmp0(type, "Entiers (Int)") == 0) g_string_append_printf(str, "%d ", *(int*)root->data);
-    else g_string_append_printf(str, "? ");
-
-    NaryNode *child = root->first_child;
-    while (child) {
-        preorder_nary(child, str, type);
-        child = child->next_sibling;
+    TreeStack stack = {0};
+    if (root) tree_stack_push(&stack, root);
+    while (stack.count) {
+        NaryNode *node = tree_stack_pop(&stack);
+        append_tree_value(str, node->data, type);
+        if (node != root && node->next_sibling) tree_stack_push(&stack, node->next_sibling);
+        if (node->first_child) tree_stack_push(&stack, node->first_child);
     }
+    tree_stack_free(&stack);
 }
 
 static void postorder_nary(NaryNode *root, GString *str, const gchar *type) {
-    if (!root) return;
-
-    NaryNode *child = root->first_child;
-    while (child) {
-        postorder_nary(child, str, type);
-        child = child->next_sibling;
+    TreeStack stack = {0};
+    NaryNode *node = root;
+    while (node || stack.count) {
+        while (node) {
+            tree_stack_push(&stack, node);
+            node = node->first_child;
+        }
+        node = tree_stack_pop(&stack);
+        append_tree_value(str, node->data, type);
+        node = (node != root) ? node->next_sibling : NULL;
     }
-
-    if (g_strcmp0(type, "Entiers (Int)") == 0) g_string_append_printf(str, "%d ", *(int*)root->data);
-    else g_string_append_printf(str, "? ");
+    tree_stack_free(&stack);
 }
 
 static void bfs_nary(NaryNode *root, GString *str, const gchar *type) {
@@ -5096,26 +9722,39 @@ static void bfs_nary(NaryNode *root, GString *str, const gchar *type) {
 
 // --- Stats pour N-Aire ---
 static int nary_size(NaryNode *root) {
-    if (!root) return 0;
-    int count = 1;
-    NaryNode *child = root->first_child;
-    while (child) {
-        count += nary_size(child);
-        child = child->next_sibling;
+    TreeStack stack = {0};
+    int count = 0;
+    if (root) tree_stack_push(&stack, root);
+    while (stack.count) {
+        NaryNode *node = tree_stack_pop(&stack);
+        count++;
+        for (NaryNode *child = node->first_child; child; child = child->next_sibling) {
+            tree_stack_push(&stack, child);
+        }
     }
+    tree_stack_free(&stack);
     return count;
 }
 
 static int nary_depth(NaryNode *root) {
-    if (!root) return 0;
-    int max_depth = 0;
-    NaryNode *child = root->first_child;
-    while (child) {
-        int child_depth = nary_depth(child);
-        if (child_depth > max_depth) max_depth = child_depth;
-        child = child->next_sibling;
+    TreeStack level = {0}, next = {0};
+    int depth = 0;
+    if (root) tree_stack_push(&level, root);
+    while (level.count) {
+        depth++;
+        while (level.count) {
+            NaryNode *node = tree_stack_pop(&level);
+            for (NaryNode *child = node->first_child; child; child = child->next_sibling) {
+                tree_stack_push(&next, child);
+            }
+        }
+        TreeStack swap = level;
+        level = next;
+        next = swap;
     }
-    return 1 + max_depth;
+    tree_stack_free(&level);
+    tree_stack_free(&next);
+    return depth;
 }
 
 // Constantes pour le dessin des arbres
@@ -5123,616 +9762,688 @@ static int nary_depth(NaryNode *root) {
 #define VERTICAL_SPACING 80.0
 #define HORIZONTAL_SPACING 60.0
 
-// --- Structure pour mapper un nœud à sa position ---
-typedef struct {
-    BinaryNode *node;
-    double x;
-    double y;
-} NodePosMap;
-
-// --- Structure pour mapper un nœud N-Aire à sa position ---
-typedef struct {
-    NaryNode *node;
-    double x;
-    double y;
-} NaryNodePosMap;
-
-// --- Positionnement des arbres binaires via parcours infixe ---
-// Assure l'ordre gauche-parent-droit et respecte la définition d'un arbre binaire.
-static void assign_binary_positions(BinaryNode *node, NodePosMap *map, int *map_index,
-                                    double *cursor_x, double start_y, int level) {
-    if (!node) return;
-
-    // Parcours infixe pour garantir : sous-arbre gauche -> parent -> sous-arbre droit
-    assign_binary_positions(node->left, map, map_index, cursor_x, start_y, level + 1);
-
-    // Position du nœud courant
-    double node_x = *cursor_x;
-    map[*map_index].node = node;
-    map[*map_index].x = node_x;
-    map[*map_index].y = start_y + level * VERTICAL_SPACING;
-    (*map_index)++;
-
-    // Avancer l'abscisse pour le prochain nœud (même niveau ou droit)
-    *cursor_x += HORIZONTAL_SPACING;
-
-    assign_binary_positions(node->right, map, map_index, cursor_x, start_y, level + 1);
-}
-
-// --- Trouver la position d'un nœud dans le map ---
-static NodePosMap* find_node_position(NodePosMap *map, int map_size, BinaryNode *node) {
-    for (int i = 0; i < map_size; i++) {
-        if (map[i].node == node) {
-            return &map[i];
-        }
-    }
-    return NULL;
-}
-
-
-// --- Dessiner un nœud avec une seule branche blanche vers chaque enfant ---
-static void draw_binary_node_with_map(cairo_t *cr, BinaryNode *node, NodePosMap *map, int map_size, const gchar *type) {
-    if (!node) return;
-
-    NodePosMap *node_pos = find_node_position(map, map_size, node);
-    if (!node_pos) return;
-
-    double x = node_pos->x;
-    double y = node_pos->y;
-
-    // Dessiner les branches blanches vers les enfants AVANT les nœuds
-    cairo_set_source_rgb(cr, 1.0, 1.0, 1.0); // White branches
-    cairo_set_line_width(cr, 2.0);
+// --- Disposition en cache de l'arbre binaire ---
+// Calculée une seule fois après chaque modification (parcours infixe, O(n)) puis réutilisée
+// par le dessin, le dimensionnement et les clics. La colonne d'un nœud est son rang infixe:
+// gauche -> parent -> droit, ce qui respecte la définition d'un arbre binaire.
+static void binary_layout_invalidate(AppData *app_data) {
+    app_data->binary_layout_valid = FALSE;
+    app_data->tree_hover_node = NULL; // Le nœud survolé a pu être libéré ou déplacé
+}
+
+static void binary_layout_ensure(AppData *app_data) {
+    if (app_data->binary_layout_valid) return;
+
+    g_free(app_data->binary_layout_nodes);
+    app_data->binary_layout_nodes = NULL;
+    app_data->binary_layout_half_width = 0.0;
+    app_data->binary_layout_max_y = 0.0;
+
+    int count = binary_size(app_data->binary_root);
+    app_data->binary_layout_count = count;
+    if (count > 0) {
+        BinaryNode **nodes = g_new(BinaryNode *, count);
+        // Centrer l'arbre horizontalement: colonnes de -half à +half
+        double half = (count - 1) * HORIZONTAL_SPACING / 2.0;
+        int index = 0;
+        int level = 0;
+        int max_level = 0;
+
+        // La pile alterne nœud et niveau (deux entrées par nœud en attente)
+        TreeStack stack = {0};
+        BinaryNode *node = app_data->binary_root;
+        while (node || stack.count) {
+            while (node) {
+                tree_stack_push(&stack, node);
+                tree_stack_push(&stack, GINT_TO_POINTER(level));
+                node = node->left;
+                level++;
+            }
+            level = GPOINTER_TO_INT(tree_stack_pop(&stack));
+            node = tree_stack_pop(&stack);
 
-    if (node->left) {
-        NodePosMap *left_pos = find_node_position(map, map_size, node->left);
-        if (left_pos) {
-            // Une seule branche blanche du bord inférieur du parent au bord supérieur de l'enfant
-            cairo_move_to(cr, x, y + NODE_RADIUS);
-            cairo_line_to(cr, left_pos->x, left_pos->y - NODE_RADIUS);
-            cairo_stroke(cr);
-        }
-    }
+            node->x = index * HORIZONTAL_SPACING - half;
+            node->y = level * VERTICAL_SPACING;
+            if (level > max_level) max_level = level;
+            nodes[index++] = node;
 
-    if (node->right) {
-        NodePosMap *right_pos = find_node_position(map, map_size, node->right);
-        if (right_pos) {
-            // Une seule branche blanche du bord inférieur du parent au bord supérieur de l'enfant
-            cairo_move_to(cr, x, y + NODE_RADIUS);
-            cairo_line_to(cr, right_pos->x, right_pos->y - NODE_RADIUS);
-            cairo_stroke(cr);
+            node = node->right;
+            level++;
         }
-    }
+        tree_stack_free(&stack);
 
-    // Dessiner récursivement les enfants
-    if (node->left) {
-        draw_binary_node_with_map(cr, node->left, map, map_size, type);
-    }
-
-    if (node->right) {
-        draw_binary_node_with_map(cr, node->right, map, map_size, type);
-    }
-
-    // Dessiner le cercle du nœud (fond blanc, comme l'arbre n-aire)
-    cairo_set_source_rgb(cr, 1.0, 1.0, 1.0); // White fill (comme l'arbre n-aire)
-    cairo_arc(cr, x, y, NODE_RADIUS, 0, 2 * M_PI);
-    cairo_fill(cr); // Pas de stroke pour enlever la bordure
-
-    // Dessiner le texte (noir pour que les nombres soient visibles)
-    gchar text[32];
-    if (g_strcmp0(type, "Entiers (Int)") == 0) {
-        snprintf(text, 32, "%d", *(int*)node->data);
-    } else if (g_strcmp0(type, "Réels (Float)") == 0) {
-        snprintf(text, 32, "%.1f", *(float*)node->data);
-    } else if (g_strcmp0(type, "Caractères (Char)") == 0) {
-        snprintf(text, 32, "%c", *(char*)node->data);
-    } else {
-        snprintf(text, 32, "?");
+        app_data->binary_layout_nodes = nodes;
+        app_data->binary_layout_half_width = half;
+        app_data->binary_layout_max_y = max_level * VERTICAL_SPACING;
     }
-
-    cairo_set_source_rgb(cr, 0.0, 0.0, 0.0); // Black Text pour visibilité
-    cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_BOLD);
-    cairo_set_font_size(cr, 13);
-    cairo_text_extents_t extents;
-    cairo_text_extents(cr, text, &extents);
-    cairo_move_to(cr, x - extents.width/2, y + extents.height/2);
-    cairo_show_text(cr, text);
+    app_data->binary_layout_valid = TRUE;
 }
 
-// --- Calculer les dimensions nécessaires pour un arbre binaire ---
-static void calculate_binary_tree_bounds(BinaryNode *root, double start_x, double start_y,
-                                         double *min_x, double *max_x, double *max_y) {
-    if (!root) {
-        *min_x = start_x;
-        *max_x = start_x;
-        *max_y = start_y;
-        return;
-    }
+// --- Vue de l'arbre: zoom, élagage hors écran et niveau de détail ---
+// Le dessin se fait dans le repère de la disposition en cache, mis à l'échelle par le zoom.
+// Seuls les sous-arbres dont la boîte englobante coupe la zone à redessiner sont parcourus;
+// en vue éloignée, un sous-arbre trop étroit à l'écran est replié en triangle de densité.
+#define TREE_MARGIN 40.0       // Marge autour de la disposition (unités de la disposition)
+#define TREE_ZOOM_MAX 4.0
+#define TREE_ZOOM_STEP 1.25
+#define TREE_LOD_ZOOM 0.35     // En dessous: plus d'étiquettes, repli des petits sous-arbres
+#define TREE_LOD_PIXELS 24.0   // Largeur à l'écran sous laquelle un sous-arbre est replié
 
-    int node_count = binary_size(root);
-    if (node_count == 0) {
-        *min_x = start_x;
-        *max_x = start_x;
-        *max_y = start_y;
-        return;
-    }
+typedef struct {
+    double x1, y1, x2, y2;
+} TreeRect;
+
+static gboolean tree_rect_intersects(const TreeRect *clip, double x1, double y1, double x2, double y2) {
+    return x2 >= clip->x1 && x1 <= clip->x2 && y2 >= clip->y1 && y1 <= clip->y2;
+}
+
+// Sous-arbre replié: triangle sous sa racine, d'autant plus opaque qu'il est dense,
+// avec le nombre de nœuds quand la place le permet
+static void draw_tree_collapsed_subtree(cairo_t *cr, double zoom, double x, double y,
+                                        double min_x, double max_x, double max_y, int size) {
+    double min_half = 2.0 / zoom; // Au moins quelques pixels de large (chaînes)
+    if (max_x - min_x < 2 * min_half) {
+        min_x = x - min_half;
+        max_x = x + min_half;
+    }
+    if (max_y - y < 2 * min_half) max_y = y + 2 * min_half;
+
+    double width_px = (max_x - min_x) * zoom;
+    double height_px = (max_y - y) * zoom;
+    double density = size / fmax(1.0, width_px * height_px / 100.0); // Nœuds par case de 10x10 px
+    cairo_set_source_rgba(cr, 0.55, 0.75, 1.0, 0.3 + 0.5 * fmin(1.0, density));
+    cairo_move_to(cr, x, y);
+    cairo_line_to(cr, max_x, max_y);
+    cairo_line_to(cr, min_x, max_y);
+    cairo_close_path(cr);
+    cairo_fill(cr);
 
-    NodePosMap *map = g_new0(NodePosMap, node_count);
-    int map_index = 0;
-    double cursor_x = 0.0;
-    assign_binary_positions(root, map, &map_index, &cursor_x, start_y, 0);
-
-    // Centrer l'arbre horizontalement
-    if (node_count > 0) {
-        double min = map[0].x;
-        double max = map[0].x;
-        double max_y_val = map[0].y;
-        for (int i = 1; i < node_count; i++) {
-            if (map[i].x < min) min = map[i].x;
-            if (map[i].x > max) max = map[i].x;
-            if (map[i].y > max_y_val) max_y_val = map[i].y;
-        }
-        double center_offset = start_x - (min + max) / 2.0;
-        for (int i = 0; i < node_count; i++) {
-            map[i].x += center_offset;
-        }
-        // Recalculer min/max après centrage
-        min = map[0].x;
-        max = map[0].x;
-        for (int i = 1; i < node_count; i++) {
-            if (map[i].x < min) min = map[i].x;
-            if (map[i].x > max) max = map[i].x;
-        }
-        *min_x = min - NODE_RADIUS;
-        *max_x = max + NODE_RADIUS;
-        *max_y = max_y_val + NODE_RADIUS;
-    } else {
-        *min_x = start_x;
-        *max_x = start_x;
-        *max_y = start_y;
+    if (height_px >= 16.0 && width_px >= 24.0) {
+        gchar text[32];
+        snprintf(text, 32, "%d", size);
+        cairo_set_font_size(cr, 11.0 / zoom);
+        cairo_text_extents_t extents;
+        cairo_text_extents(cr, text, &extents);
+        cairo_set_source_rgb(cr, 1.0, 1.0, 1.0);
+        cairo_move_to(cr, x - extents.width / 2, max_y - 3.0 / zoom);
+        cairo_show_text(cr, text);
     }
-
-    g_free(map);
 }
 
 // --- Fonction principale de dessin améliorée ---
-static void draw_binary_tree_improved(cairo_t *cr, BinaryNode *root, double start_x, double start_y, const gchar *type) {
-    if (!root) return;
-
-    // Compter le nombre de nœuds
-    int node_count = binary_size(root);
-    if (node_count == 0) return;
+// Parcours élagué depuis la racine (boîtes englobantes en O(1) grâce à la taille et à la
+// hauteur des sous-arbres), puis toutes les branches, les sous-arbres repliés et les nœuds
+static void draw_binary_tree_improved(cairo_t *cr, AppData *app_data, double zoom, const TreeRect *clip, const gchar *type) {
+    binary_layout_ensure(app_data);
+    if (app_data->binary_layout_count == 0) return;
+    gboolean lod = zoom < TREE_LOD_ZOOM;
+
+    TreeStack stack = {0}, shown = {0}, collapsed = {0};
+    tree_stack_push(&stack, app_data->binary_root);
+    while (stack.count) {
+        BinaryNode *node = tree_stack_pop(&stack);
+        // Le sous-arbre occupe les colonnes voisines de sa racine, sur node->height niveaux
+        double min_x = node->x - binary_node_size(node->left) * HORIZONTAL_SPACING;
+        double max_x = node->x + binary_node_size(node->right) * HORIZONTAL_SPACING;
+        double max_y = node->y + (node->height - 1) * VERTICAL_SPACING;
+        if (!tree_rect_intersects(clip, min_x - NODE_RADIUS, node->y - NODE_RADIUS, max_x + NODE_RADIUS, max_y + NODE_RADIUS)) continue;
+
+        if (lod && node->size > 1 && (max_x - min_x) * zoom < TREE_LOD_PIXELS) {
+            tree_stack_push(&collapsed, node);
+            continue;
+        }
+        tree_stack_push(&shown, node);
+        if (node->right) tree_stack_push(&stack, node->right);
+        if (node->left) tree_stack_push(&stack, node->left);
+    }
+    tree_stack_free(&stack);
 
-    // Allouer un tableau pour mapper les nœuds aux positions
-    NodePosMap *map = g_new0(NodePosMap, node_count);
+    // Dessiner les branches blanches vers les enfants AVANT les nœuds
+    cairo_set_source_rgb(cr, 1.0, 1.0, 1.0); // White branches
+    cairo_set_line_width(cr, fmax(2.0, 1.0 / zoom));
 
-    // Assigner les positions avec l'algorithme amélioré
-    int map_index = 0;
-    double cursor_x = 0.0;
-    assign_binary_positions(root, map, &map_index, &cursor_x, start_y, 0);
+    for (size_t i = 0; i < shown.count; i++) {
+        BinaryNode *parent = shown.items[i];
 
-    // Centrer l'arbre horizontalement
-    if (node_count > 0) {
-        double min_x = map[0].x;
-        double max_x = map[0].x;
-        for (int i = 1; i < node_count; i++) {
-            if (map[i].x < min_x) min_x = map[i].x;
-            if (map[i].x > max_x) max_x = map[i].x;
+        // Une seule branche blanche du bord inférieur du parent au bord supérieur de l'enfant
+        BinaryNode *children[2] = {parent->left, parent->right};
+        for (int c = 0; c < 2; c++) {
+            BinaryNode *child = children[c];
+            if (!child || !tree_rect_intersects(clip, fmin(parent->x, child->x), parent->y,
+                                                fmax(parent->x, child->x), child->y)) continue;
+            cairo_move_to(cr, parent->x, parent->y + NODE_RADIUS);
+            cairo_line_to(cr, child->x, child->y - NODE_RADIUS);
         }
-        double center_offset = start_x - (min_x + max_x) / 2.0;
-        for (int i = 0; i < node_count; i++) {
-            map[i].x += center_offset;
-        }
-    }
-
-    // Dessiner l'arbre
-    draw_binary_node_with_map(cr, root, map, node_count, type);
-    g_free(map);
-}
-
-// --- Drawing N-Ary Tree (Recursive) ---
-static int count_nary_children(NaryNode *node) {
-    if (!node || !node->first_child) return 0;
-    int count = 1;
-    NaryNode *child = node->first_child->next_sibling;
-    while (child) {
-        count++;
-        child = child->next_sibling;
-    }
-    return count;
-}
-
-// --- Calculer la largeur nécessaire pour un sous-arbre n-aire ---
-static double calculate_nary_width(NaryNode *node, double x_spacing) {
-    if (!node) return 0.0;
-
-    int child_count = count_nary_children(node);
-    if (child_count == 0) return x_spacing;
-
-    double total_width = 0.0;
-    NaryNode *child = node->first_child;
-    while (child) {
-        total_width += calculate_nary_width(child, x_spacing);
-        child = child->next_sibling;
     }
+    cairo_stroke(cr);
 
-    // Si un seul enfant, utiliser au moins x_spacing
-    if (child_count == 1) {
-        return (total_width > x_spacing) ? total_width : x_spacing;
-    }
-
-    // Plusieurs enfants : utiliser la largeur totale ou l'espacement minimum
-    return (total_width > (child_count - 1) * x_spacing) ? total_width : (child_count - 1) * x_spacing;
-}
-
-// --- Fonction récursive pour calculer les dimensions d'un arbre n-aire ---
-static void calculate_nary_recursive(NaryNode *node, double x, double y, double x_spacing,
-                                     double *min_x, double *max_x, double *max_y) {
-    if (!node) return;
-
-    // Mettre à jour les bornes
-    if (x - NODE_RADIUS < *min_x) *min_x = x - NODE_RADIUS;
-    if (x + NODE_RADIUS > *max_x) *max_x = x + NODE_RADIUS;
-    if (y + NODE_RADIUS > *max_y) *max_y = y + NODE_RADIUS;
-
-    int child_count = count_nary_children(node);
-    double total_children_width = 0.0;
-
-    if (child_count > 0) {
-        NaryNode *child = node->first_child;
-        while (child) {
-            total_children_width += calculate_nary_width(child, x_spacing);
-            child = child->next_sibling;
-        }
-        if (total_children_width < (child_count - 1) * x_spacing) {
-            total_children_width = (child_count - 1) * x_spacing;
-        }
+    cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_BOLD);
+    for (size_t i = 0; i < collapsed.count; i++) {
+        BinaryNode *node = collapsed.items[i];
+        draw_tree_collapsed_subtree(cr, zoom, node->x, node->y,
+                                    node->x - binary_node_size(node->left) * HORIZONTAL_SPACING,
+                                    node->x + binary_node_size(node->right) * HORIZONTAL_SPACING,
+                                    node->y + (node->height - 1) * VERTICAL_SPACING, node->size);
     }
+    tree_stack_free(&collapsed);
 
-    double child_start_x = x - total_children_width / 2.0;
-    double child_y = y + VERTICAL_SPACING;
-    double current_x = child_start_x;
-
-    if (node->first_child) {
-        NaryNode *child = node->first_child;
-        while (child) {
-            double child_width = calculate_nary_width(child, x_spacing);
-            double child_x = current_x + child_width / 2.0;
-            calculate_nary_recursive(child, child_x, child_y, x_spacing, min_x, max_x, max_y);
-            current_x += child_width;
-            child = child->next_sibling;
+    cairo_set_font_size(cr, 13);
+    double radius = lod ? fmax(NODE_RADIUS, 1.5 / zoom) : NODE_RADIUS; // Rester visible de loin
+
+    for (size_t i = 0; i < shown.count; i++) {
+        BinaryNode *current = shown.items[i];
+        double x = current->x;
+        double y = current->y;
+        if (!tree_rect_intersects(clip, x - radius, y - radius, x + radius, y + radius)) continue;
+
+        // Dessiner le cercle du nœud (fond blanc, comme l'arbre n-aire; rouge pour les nœuds rouges)
+        if ((void *)current == app_data->tree_hover_node) cairo_set_source_rgb(cr, 0.55, 0.75, 1.0); // Nœud survolé
+        else if (current->red) cairo_set_source_rgb(cr, 0.9, 0.3, 0.3);
+        else cairo_set_source_rgb(cr, 1.0, 1.0, 1.0); // White fill (comme l'arbre n-aire)
+        cairo_arc(cr, x, y, radius, 0, 2 * M_PI);
+        cairo_fill(cr); // Pas de stroke pour enlever la bordure
+        if (lod) continue; // Étiquettes illisibles à cette échelle
+
+        // Dessiner le texte (noir pour que les nombres soient visibles)
+        gchar text[32];
+        if (g_strcmp0(type, "Entiers (Int)") == 0) {
+            snprintf(text, 32, "%d", *(int*)current->data);
+        } else if (g_strcmp0(type, "Réels (Float)") == 0) {
+            snprintf(text, 32, "%.1f", *(float*)current->data);
+        } else if (g_strcmp0(type, "Caractères (Char)") == 0) {
+            snprintf(text, 32, "%c", *(char*)current->data);
+        } else {
+            snprintf(text, 32, "?");
         }
-    }
-}
 
-// --- Calculer les dimensions nécessaires pour un arbre n-aire ---
-static void calculate_nary_tree_bounds(NaryNode *root, double start_x, double start_y, double x_spacing,
-                                       double *min_x, double *max_x, double *max_y) {
-    if (!root) {
-        *min_x = start_x;
-        *max_x = start_x;
-        *max_y = start_y;
-        return;
+        cairo_set_source_rgb(cr, 0.0, 0.0, 0.0); // Black Text pour visibilité
+        cairo_text_extents_t extents;
+        cairo_text_extents(cr, text, &extents);
+        cairo_move_to(cr, x - extents.width/2, y + extents.height/2);
+        cairo_show_text(cr, text);
     }
-
-    *min_x = start_x;
-    *max_x = start_x;
-    *max_y = start_y;
-    calculate_nary_recursive(root, start_x, start_y, x_spacing, min_x, max_x, max_y);
+    tree_stack_free(&shown);
 }
 
-// --- Construire le map des positions pour les arbres N-Aires ---
-static void assign_nary_positions(NaryNode *node, NaryNodePosMap *map, int *map_index,
-                                  double x, double y, double x_spacing) {
-    if (!node) return;
-
-    // Enregistrer la position du nœud courant
-    map[*map_index].node = node;
-    map[*map_index].x = x;
-    map[*map_index].y = y;
-    (*map_index)++;
-
-    // Calculer la largeur nécessaire pour tous les enfants
-    int child_count = count_nary_children(node);
-    double total_children_width = 0.0;
-
-    if (child_count > 0) {
-        NaryNode *child = node->first_child;
-        while (child) {
-            total_children_width += calculate_nary_width(child, x_spacing);
-            child = child->next_sibling;
-        }
-        if (total_children_width < (child_count - 1) * x_spacing) {
-            total_children_width = (child_count - 1) * x_spacing;
+// --- Disposition en cache de l'arbre N-Aire (Reingold-Tilford, version linéaire de Walker) ---
+// Chaque sous-arbre est placé le plus près possible de ses frères de gauche: les contours
+// sont suivis par des fils ("threads") et les décalages accumulés dans des modificateurs,
+// ce qui donne O(n) au total (Buchheim, Jünger, Leipert). Un parcours postfixe calcule les
+// positions provisoires, un parcours préfixe les positions finales et les bornes.
+// Les liens sont des indices dans un tableau de travail libéré après le calcul.
+typedef struct {
+    NaryNode *node;
+    int parent;
+    int first_child;
+    int last_child;
+    int prev_sibling;
+    int next_sibling;
+    int number;           // Rang parmi les frères
+    int depth;
+    int thread;           // Suite du contour quand le nœud n'a pas d'enfant
+    int ancestor;
+    int default_ancestor; // Pour les enfants du nœud pendant apportion
+    int cursor;           // Prochain enfant à visiter (parcours postfixe)
+    double prelim;
+    double mod;
+    double change;
+    double shift;
+    double mod_sum;       // Somme des modificateurs des ancêtres
+} NaryWalkNode;
+
+// Écart minimal entre deux centres voisins sur un même niveau
+#define NARY_NODE_DISTANCE HORIZONTAL_SPACING
+
+static int nary_walk_next_left(NaryWalkNode *w, int v) {
+    return w[v].first_child >= 0 ? w[v].first_child : w[v].thread;
+}
+
+static int nary_walk_next_right(NaryWalkNode *w, int v) {
+    return w[v].last_child >= 0 ? w[v].last_child : w[v].thread;
+}
+
+static void nary_walk_move_subtree(NaryWalkNode *w, int wl, int wr, double shift) {
+    double subtrees = w[wr].number - w[wl].number;
+    w[wr].change -= shift / subtrees;
+    w[wr].shift += shift;
+    w[wl].change += shift / subtrees;
+    w[wr].prelim += shift;
+    w[wr].mod += shift;
+}
+
+static void nary_walk_execute_shifts(NaryWalkNode *w, int v) {
+    double shift = 0.0, change = 0.0;
+    for (int c = w[v].last_child; c >= 0; c = w[c].prev_sibling) {
+        w[c].prelim += shift;
+        w[c].mod += shift;
+        change += w[c].change;
+        shift += w[c].shift + change;
+    }
+}
+
+// Rapproche le sous-arbre v de ceux de ses frères de gauche sans chevauchement
+static int nary_walk_apportion(NaryWalkNode *w, int v, int default_ancestor) {
+    int left = w[v].prev_sibling;
+    if (left < 0) return default_ancestor;
+
+    int vir = v, vor = v;
+    int vil = left;
+    int vol = w[w[v].parent].first_child;
+    double sir = w[vir].mod, sor = w[vor].mod;
+    double sil = w[vil].mod, sol = w[vol].mod;
+
+    while (nary_walk_next_right(w, vil) >= 0 && nary_walk_next_left(w, vir) >= 0) {
+        vil = nary_walk_next_right(w, vil);
+        vir = nary_walk_next_left(w, vir);
+        vol = nary_walk_next_left(w, vol);
+        vor = nary_walk_next_right(w, vor);
+        w[vor].ancestor = v;
+
+        double shift = (w[vil].prelim + sil) - (w[vir].prelim + sir) + NARY_NODE_DISTANCE;
+        if (shift > 0) {
+            int a = (w[w[vil].ancestor].parent == w[v].parent) ? w[vil].ancestor : default_ancestor;
+            nary_walk_move_subtree(w, a, v, shift);
+            sir += shift;
+            sor += shift;
+        }
+        sil += w[vil].mod;
+        sir += w[vir].mod;
+        sol += w[vol].mod;
+        sor += w[vor].mod;
+    }
+
+    if (nary_walk_next_right(w, vil) >= 0 && nary_walk_next_right(w, vor) < 0) {
+        w[vor].thread = nary_walk_next_right(w, vil);
+        w[vor].mod += sil - sor;
+    }
+    if (nary_walk_next_left(w, vir) >= 0 && nary_walk_next_left(w, vol) < 0) {
+        w[vol].thread = nary_walk_next_left(w, vir);
+        w[vol].mod += sir - sol;
+        default_ancestor = v;
+    }
+    return default_ancestor;
+}
+
+static void nary_layout_invalidate(AppData *app_data) {
+    app_data->nary_layout_valid = FALSE;
+    app_data->tree_hover_node = NULL;
+}
+
+static void nary_layout_ensure(AppData *app_data) {
+    if (app_data->nary_layout_valid) return;
+
+    g_free(app_data->nary_layout_nodes);
+    g_free(app_data->nary_layout_row_start);
+    app_data->nary_layout_nodes = NULL;
+    app_data->nary_layout_row_start = NULL;
+    app_data->nary_layout_levels = 0;
+    app_data->nary_layout_min_x = app_data->nary_layout_max_x = app_data->nary_layout_max_y = 0.0;
+
+    int count = nary_size(app_data->nary_root);
+    app_data->nary_layout_count = count;
+    app_data->nary_layout_valid = TRUE;
+    if (count == 0) return;
+
+    NaryWalkNode *w = g_new0(NaryWalkNode, count);
+
+    // Tableau de travail en pré-ordre (parent avant enfants, frères de gauche à droite).
+    // La pile alterne nœud et indice du parent; le frère suivant est empilé sous le premier enfant.
+    TreeStack stack = {0};
+    tree_stack_push(&stack, app_data->nary_root);
+    tree_stack_push(&stack, GINT_TO_POINTER(-1));
+    int n = 0;
+    while (stack.count) {
+        int parent = GPOINTER_TO_INT(tree_stack_pop(&stack));
+        NaryNode *node = tree_stack_pop(&stack);
+        int v = n++;
+        w[v].node = node;
+        w[v].parent = parent;
+        w[v].first_child = w[v].last_child = w[v].next_sibling = w[v].prev_sibling = -1;
+        w[v].thread = -1;
+        w[v].ancestor = v;
+        if (parent >= 0) {
+            int prev = w[parent].last_child;
+            if (prev >= 0) {
+                w[prev].next_sibling = v;
+                w[v].prev_sibling = prev;
+                w[v].number = w[prev].number + 1;
+            } else {
+                w[parent].first_child = v;
+            }
+            w[parent].last_child = v;
+            w[v].depth = w[parent].depth + 1;
         }
-    }
-
-    // Position de départ pour les enfants
-    double child_start_x = x - total_children_width / 2.0;
-    double child_y = y + VERTICAL_SPACING;
-    double current_x = child_start_x;
 
-    // Assigner les positions des enfants récursivement
-    if (node->first_child) {
-        NaryNode *child = node->first_child;
-        while (child) {
-            double child_width = calculate_nary_width(child, x_spacing);
-            double child_x = current_x + child_width / 2.0;
-            assign_nary_positions(child, map, map_index, child_x, child_y, x_spacing);
-            current_x += child_width;
-            child = child->next_sibling;
+        if (parent >= 0 && node->next_sibling) {
+            tree_stack_push(&stack, node->next_sibling);
+            tree_stack_push(&stack, GINT_TO_POINTER(parent));
         }
-    }
-}
-
-// --- Trouver la position d'un nœud N-Aire dans le map ---
-static NaryNodePosMap* find_nary_node_position(NaryNodePosMap *map, int map_size, NaryNode *node) {
-    for (int i = 0; i < map_size; i++) {
-        if (map[i].node == node) {
-            return &map[i];
+        if (node->first_child) {
+            tree_stack_push(&stack, node->first_child);
+            tree_stack_push(&stack, GINT_TO_POINTER(v));
         }
     }
-    return NULL;
-}
-
-// --- Dessiner l'arbre n-aire avec un meilleur layout ---
-static double draw_nary_node_recursive(cairo_t *cr, NaryNode *node, double x, double y, double x_spacing, const gchar *type) {
-    if (!node) return 0.0;
-
-    // Calculer la largeur nécessaire pour tous les enfants
-    int child_count = count_nary_children(node);
-    double total_children_width = 0.0;
-
-    if (child_count > 0) {
-        NaryNode *child = node->first_child;
-        while (child) {
-            total_children_width += calculate_nary_width(child, x_spacing);
-            child = child->next_sibling;
-        }
-        // Espacement minimum entre enfants
-        if (total_children_width < (child_count - 1) * x_spacing) {
-            total_children_width = (child_count - 1) * x_spacing;
-        }
+    for (int v = 0; v < n; v++) {
+        w[v].cursor = w[v].first_child;
+        w[v].default_ancestor = w[v].first_child;
     }
 
-    // Position de départ pour les enfants (centrés sous le parent)
-    double child_start_x = x - total_children_width / 2.0;
-    double child_y = y + VERTICAL_SPACING;
-    double current_x = child_start_x;
-
-    // Dessiner les lignes et les enfants
-    if (node->first_child) {
-        NaryNode *child = node->first_child;
-        while (child) {
-            double child_width = calculate_nary_width(child, x_spacing);
-            double child_x = current_x + child_width / 2.0;
-
-            // Dessiner la ligne AVANT le nœud parent
-            cairo_set_source_rgb(cr, 1.0, 1.0, 1.0); // White lines
-            cairo_set_line_width(cr, 2.0);
-            cairo_move_to(cr, x, y + NODE_RADIUS);
-            cairo_line_to(cr, child_x, child_y - NODE_RADIUS);
-            cairo_stroke(cr);
-            // Dessiner récursivement l'enfant
-            draw_nary_node_recursive(cr, child, child_x, child_y, x_spacing, type);
-
-            current_x += child_width;
-            child = child->next_sibling;
+    // Parcours postfixe: positions provisoires, puis rapprochement du sous-arbre
+    // terminé contre ses frères de gauche déjà placés
+    tree_stack_push(&stack, GINT_TO_POINTER(0));
+    while (stack.count) {
+        int v = GPOINTER_TO_INT(stack.items[stack.count - 1]);
+        if (w[v].cursor >= 0) {
+            int c = w[v].cursor;
+            w[v].cursor = w[c].next_sibling;
+            tree_stack_push(&stack, GINT_TO_POINTER(c));
+            continue;
         }
-    }
+        tree_stack_pop(&stack);
 
-    // Dessiner le nœud PAR-DESSUS les lignes (fond blanc)
-    cairo_set_source_rgb(cr, 1.0, 1.0, 1.0); // White fill
-    cairo_arc(cr, x, y, NODE_RADIUS, 0, 2 * M_PI);
-    cairo_fill(cr); // Pas de stroke pour enlever la bordure
-
-    // Dessiner le texte (noir pour que les nombres soient visibles)
-    gchar text[32];
-    if (g_strcmp0(type, "Entiers (Int)") == 0) {
-        snprintf(text, 32, "%d", *(int*)node->data);
-    } else if (g_strcmp0(type, "Réels (Float)") == 0) {
-        snprintf(text, 32, "%.1f", *(float*)node->data);
-    } else if (g_strcmp0(type, "Caractères (Char)") == 0) {
-        snprintf(text, 32, "%c", *(char*)node->data);
-    } else {
-        snprintf(text, 32, "?");
-    }
-
-    cairo_set_source_rgb(cr, 0.0, 0.0, 0.0); // Black Text pour visibilité
-    cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_BOLD);
-    cairo_set_font_size(cr, 13);
-    cairo_text_extents_t extents;
-    cairo_text_extents(cr, text, &extents);
-    cairo_move_to(cr, x - extents.width/2, y + extents.height/2);
-    cairo_show_text(cr, text);
-
-    // Retourner la largeur utilisée
-    return (total_children_width > x_spacing) ? total_children_width : x_spacing;
-}
+        int left = w[v].prev_sibling;
+        if (w[v].first_child < 0) {
+            w[v].prelim = left >= 0 ? w[left].prelim + NARY_NODE_DISTANCE : 0.0;
+        } else {
+            nary_walk_execute_shifts(w, v);
+            double midpoint = (w[w[v].first_child].prelim + w[w[v].last_child].prelim) / 2.0;
+            if (left >= 0) {
+                w[v].prelim = w[left].prelim + NARY_NODE_DISTANCE;
+                w[v].mod = w[v].prelim - midpoint;
+            } else {
+                w[v].prelim = midpoint;
+            }
+        }
+        int parent = w[v].parent;
+        if (parent >= 0) {
+            w[parent].default_ancestor = nary_walk_apportion(w, v, w[parent].default_ancestor);
+        }
+    }
+    tree_stack_free(&stack);
 
-// Espacement adaptatif pour les arbres N-aires (branches courtes et compactes)
-static double compute_nary_spacing(int tree_size, int max_children, double viewport_width) {
-    // Base réduite pour des branches plus courtes
-    double base = viewport_width / 10.0;
-    if (base < 40.0) base = 40.0; // Minimum réduit
+    // Parcours préfixe (ordre du tableau): positions finales et bornes, racine en x = 0
+    double min_x = 0.0, max_x = 0.0;
+    int max_depth = 0;
+    w[0].mod_sum = -w[0].prelim;
+    for (int v = 0; v < n; v++) {
+        if (w[v].parent >= 0) w[v].mod_sum = w[w[v].parent].mod_sum + w[w[v].parent].mod;
+        double x = w[v].prelim + w[v].mod_sum;
+        w[v].node->x = x;
+        w[v].node->y = w[v].depth * VERTICAL_SPACING;
+        if (x < min_x) min_x = x;
+        if (x > max_x) max_x = x;
+        if (w[v].depth > max_depth) max_depth = w[v].depth;
+    }
+
+    // Index spatial: les nœuds regroupés par niveau (tri par dénombrement sur la profondeur).
+    // Le pré-ordre restreint à un niveau va de gauche à droite et la disposition conserve
+    // cet ordre: chaque rangée est donc déjà triée par abscisse.
+    int levels = max_depth + 1;
+    int *row_start = g_new0(int, levels + 1);
+    for (int v = 0; v < n; v++) row_start[w[v].depth + 1]++;
+    for (int d = 0; d < levels; d++) row_start[d + 1] += row_start[d];
+    int *fill = g_new(int, levels);
+    memcpy(fill, row_start, levels * sizeof(int));
+    NaryNode **nodes = g_new(NaryNode *, n);
+    for (int v = 0; v < n; v++) nodes[fill[w[v].depth]++] = w[v].node;
+    g_free(fill);
+
+    // Boîtes englobantes des sous-arbres: en pré-ordre inverse, chaque nœud a reçu
+    // tous ses descendants avant d'être reporté sur son parent
+    for (int v = 0; v < n; v++) {
+        NaryNode *node = w[v].node;
+        node->subtree_min_x = node->subtree_max_x = node->x;
+        node->subtree_max_y = node->y;
+        node->subtree_size = 1;
+    }
+    for (int v = n - 1; v > 0; v--) {
+        NaryNode *node = w[v].node;
+        NaryNode *parent = w[w[v].parent].node;
+        if (node->subtree_min_x < parent->subtree_min_x) parent->subtree_min_x = node->subtree_min_x;
+        if (node->subtree_max_x > parent->subtree_max_x) parent->subtree_max_x = node->subtree_max_x;
+        if (node->subtree_max_y > parent->subtree_max_y) parent->subtree_max_y = node->subtree_max_y;
+        parent->subtree_size += node->subtree_size;
+    }
+    g_free(w);
+
+    app_data->nary_layout_nodes = nodes;
+    app_data->nary_layout_row_start = row_start;
+    app_data->nary_layout_levels = levels;
+    app_data->nary_layout_min_x = min_x;
+    app_data->nary_layout_max_x = max_x;
+    app_data->nary_layout_max_y = max_depth * VERTICAL_SPACING;
+}
+
+// --- Dessiner l'arbre n-aire depuis la disposition en cache ---
+// Parcours élagué par les boîtes englobantes des sous-arbres, puis toutes les branches,
+// les sous-arbres repliés et les nœuds par-dessus
+static void draw_nary_tree_cached(cairo_t *cr, AppData *app_data, double zoom, const TreeRect *clip, const gchar *type) {
+    nary_layout_ensure(app_data);
+    if (app_data->nary_layout_count == 0) return;
+    gboolean lod = zoom < TREE_LOD_ZOOM;
+
+    TreeStack stack = {0}, shown = {0}, collapsed = {0};
+    tree_stack_push(&stack, app_data->nary_root);
+    while (stack.count) {
+        NaryNode *node = tree_stack_pop(&stack);
+        if (!tree_rect_intersects(clip, node->subtree_min_x - NODE_RADIUS, node->y - NODE_RADIUS,
+                                  node->subtree_max_x + NODE_RADIUS, node->subtree_max_y + NODE_RADIUS)) continue;
+
+        if (lod && node->subtree_size > 1 && (node->subtree_max_x - node->subtree_min_x) * zoom < TREE_LOD_PIXELS) {
+            tree_stack_push(&collapsed, node);
+            continue;
+        }
+        tree_stack_push(&shown, node);
+        // Les frères sont rangés de gauche à droite: de loin, une feuille qui tombe sur le
+        // même pixel que la précédente n'apporte rien
+        double last_x = -G_MAXDOUBLE;
+        for (NaryNode *child = node->first_child; child; child = child->next_sibling) {
+            if (lod && !child->first_child) {
+                if ((child->x - last_x) * zoom < 1.0) continue;
+                last_x = child->x;
+            }
+            tree_stack_push(&stack, child);
+        }
+    }
+    tree_stack_free(&stack);
 
-    // Facteurs réduits pour un espacement plus compact
-    // Utiliser log pour croissance lente mais avec des facteurs plus petits
-    double size_factor = log(tree_size > 0 ? tree_size : 1) * 5.0; // Réduit de 15.0 à 5.0
-    double degree_factor = (max_children > 1 ? max_children - 1 : 0) * 10.0; // Réduit de 30.0 à 10.0
+    cairo_set_source_rgb(cr, 1.0, 1.0, 1.0); // White lines
+    cairo_set_line_width(cr, fmax(2.0, 1.0 / zoom));
+    for (size_t i = 0; i < shown.count; i++) {
+        NaryNode *parent = shown.items[i];
+        double last_x = -G_MAXDOUBLE;
+        for (NaryNode *child = parent->first_child; child; child = child->next_sibling) {
+            if (lod) {
+                if ((child->x - last_x) * zoom < 1.0) continue;
+                last_x = child->x;
+            }
+            if (!tree_rect_intersects(clip, fmin(parent->x, child->x), parent->y,
+                                      fmax(parent->x, child->x), child->y)) continue;
+            cairo_move_to(cr, parent->x, parent->y + NODE_RADIUS);
+            cairo_line_to(cr, child->x, child->y - NODE_RADIUS);
+        }
+    }
+    cairo_stroke(cr);
 
-    // Pour les très grands arbres, facteur supplémentaire réduit
-    if (tree_size > 1000) {
-        size_factor += (tree_size / 1000.0) * 10.0; // Réduit de 50.0 à 10.0
+    cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_BOLD);
+    for (size_t i = 0; i < collapsed.count; i++) {
+        NaryNode *node = collapsed.items[i];
+        draw_tree_collapsed_subtree(cr, zoom, node->x, node->y, node->subtree_min_x, node->subtree_max_x,
+                                    node->subtree_max_y, node->subtree_size);
     }
+    tree_stack_free(&collapsed);
 
-    double spacing = base + size_factor + degree_factor;
+    cairo_set_font_size(cr, 13);
+    double radius = lod ? fmax(NODE_RADIUS, 1.5 / zoom) : NODE_RADIUS; // Rester visible de loin
+
+    for (size_t i = 0; i < shown.count; i++) {
+        NaryNode *node = shown.items[i];
+        double x = node->x;
+        double y = node->y;
+        if (!tree_rect_intersects(clip, x - radius, y - radius, x + radius, y + radius)) continue;
+
+        // Dessiner le nœud PAR-DESSUS les lignes (fond blanc, bleu clair si survolé)
+        if ((void *)node == app_data->tree_hover_node) cairo_set_source_rgb(cr, 0.55, 0.75, 1.0);
+        else cairo_set_source_rgb(cr, 1.0, 1.0, 1.0); // White fill
+        cairo_arc(cr, x, y, radius, 0, 2 * M_PI);
+        cairo_fill(cr); // Pas de stroke pour enlever la bordure
+        if (lod) continue; // Étiquettes illisibles à cette échelle
+
+        // Dessiner le texte (noir pour que les nombres soient visibles)
+        gchar text[32];
+        if (g_strcmp0(type, "Entiers (Int)") == 0) {
+            snprintf(text, 32, "%d", *(int*)node->data);
+        } else if (g_strcmp0(type, "Réels (Float)") == 0) {
+            snprintf(text, 32, "%.1f", *(float*)node->data);
+        } else if (g_strcmp0(type, "Caractères (Char)") == 0) {
+            snprintf(text, 32, "%c", *(char*)node->data);
+        } else {
+            snprintf(text, 32, "?");
+        }
 
-    // Limiter l'espacement maximum pour éviter les branches trop longues
-    double max_spacing = viewport_width / 4.0; // Maximum basé sur le viewport
-    if (spacing > max_spacing) {
-        spacing = max_spacing;
+        cairo_set_source_rgb(cr, 0.0, 0.0, 0.0); // Black Text pour visibilité
+        cairo_text_extents_t extents;
+        cairo_text_extents(cr, text, &extents);
+        cairo_move_to(cr, x - extents.width/2, y + extents.height/2);
+        cairo_show_text(cr, text);
     }
-
-    return spacing;
+    tree_stack_free(&shown);
 }
 
-// --- Mettre à jour la taille du drawing_area en fonction de l'arbre ---
-static gboolean update_tree_drawing_area_size(gpointer data) {
-    AppData *app_data = (AppData *)data;
-    if (!app_data || !app_data->tree_drawing_area) return FALSE;
-
-    guint viewport_width = 800; // Largeur par défaut
-    guint viewport_height = 600; // Hauteur par défaut
-
-    // Obtenir la taille du viewport si le scrolled window existe
-    if (app_data->tree_scrolled_window) {
-        GtkAllocation allocation;
-        gtk_widget_get_allocation(app_data->tree_scrolled_window, &allocation);
-        viewport_width = allocation.width > 0 ? allocation.width : 800;
-        viewport_height = allocation.height > 0 ? allocation.height : 600;
-    }
+// --- Repère de la vue: écran = origine + disposition * zoom ---
+typedef struct {
+    double zoom;
+    double origin_x;
+    double origin_y;
+} TreeView;
 
-    double start_y = 40.0;
+// Bornes de l'arbre courant dans le repère de la disposition, marges comprises
+static gboolean tree_content_bounds(AppData *app_data, TreeRect *bounds) {
     double min_x, max_x, max_y;
-    int required_width, required_height;
-
     if (app_data->tree_is_nary == 0 && app_data->binary_root) {
-        // Pour les arbres binaires, utiliser le centre du viewport comme point de départ
-        double start_x = viewport_width / 2.0;
-        calculate_binary_tree_bounds(app_data->binary_root, start_x, start_y, &min_x, &max_x, &max_y);
-        required_width = (int)(max_x - min_x + 80); // Plus de padding pour éviter le clipping
-        required_height = (int)(max_y + 80);
+        // La disposition binaire en cache est centrée sur x = 0
+        binary_layout_ensure(app_data);
+        min_x = -app_data->binary_layout_half_width;
+        max_x = app_data->binary_layout_half_width;
+        max_y = app_data->binary_layout_max_y;
     } else if (app_data->tree_is_nary == 1 && app_data->nary_root) {
-        int tree_size = nary_size(app_data->nary_root);
-        // Pour les arbres N-aire, utiliser des estimations réduites car l'espacement est maintenant plus compact
-        double estimated_width = viewport_width * 1.5; // Réduit de 3.0 à 1.5
-        if (tree_size > 50) {
-            estimated_width = viewport_width * 2.0; // Réduit de 4.0 à 2.0
-        }
-        if (tree_size > 100) {
-            estimated_width = viewport_width * 2.5; // Réduit de 6.0 à 2.5
-        }
-        if (tree_size > 500) {
-            estimated_width = viewport_width * 3.0; // Réduit de 10.0 à 3.0
-        }
-        if (tree_size > 1000) {
-            estimated_width = viewport_width * 4.0; // Réduit de 15.0 à 4.0
-        }
-
-        // Calculer l'espacement avec cette largeur estimée
-        double x_spacing = compute_nary_spacing(tree_size, app_data->nary_max_children, estimated_width);
-
-        // Utiliser le centre de la largeur estimée comme point de départ
-        double start_x = estimated_width / 2.0;
-        calculate_nary_tree_bounds(app_data->nary_root, start_x, start_y, x_spacing, &min_x, &max_x, &max_y);
+        nary_layout_ensure(app_data);
+        min_x = app_data->nary_layout_min_x;
+        max_x = app_data->nary_layout_max_x;
+        max_y = app_data->nary_layout_max_y;
+    } else {
+        return FALSE;
+    }
+    bounds->x1 = min_x - NODE_RADIUS - TREE_MARGIN;
+    bounds->x2 = max_x + NODE_RADIUS + TREE_MARGIN;
+    bounds->y1 = -TREE_MARGIN;
+    bounds->y2 = max_y + NODE_RADIUS + 2 * TREE_MARGIN;
+    return TRUE;
+}
 
-        // Calculer la largeur nécessaire en tenant compte que min_x peut être négatif
-        // Avec l'espacement réduit, l'arbre devrait être plus compact
-        double actual_width = max_x - min_x;
-        required_width = (int)(actual_width + 100); // Padding réduit car branches plus courtes
-        required_height = (int)(max_y + 100);
+static void tree_viewport_size(AppData *app_data, double *width, double *height) {
+    int w = app_data->tree_drawing_area ? gtk_widget_get_allocated_width(app_data->tree_drawing_area) : 0;
+    int h = app_data->tree_drawing_area ? gtk_widget_get_allocated_height(app_data->tree_drawing_area) : 0;
+    *width = w > 0 ? w : 800.0; // Taille par défaut avant la première allocation
+    *height = h > 0 ? h : 600.0;
+}
 
-        // S'assurer que la largeur est suffisante même si min_x est très négatif
-        if (min_x < 0) {
-            double min_x_abs = -min_x; // Valeur absolue de min_x
-            // La largeur doit couvrir de min_x (négatif) à max_x (positif)
-            required_width = (int)(max_x + min_x_abs + 100);
-        }
+// Zoom minimal: l'arbre entier tient dans la vue (sans jamais dépasser la taille réelle)
+static double tree_zoom_min(AppData *app_data) {
+    TreeRect bounds;
+    if (!tree_content_bounds(app_data, &bounds)) return 1.0;
+    double width, height;
+    tree_viewport_size(app_data, &width, &height);
+    double fit = fmin(width / (bounds.x2 - bounds.x1), height / (bounds.y2 - bounds.y1));
+    return fmin(1.0, fit);
+}
 
-        // S'assurer que la largeur minimale est au moins celle estimée
-        if (required_width < (int)estimated_width) {
-            required_width = (int)estimated_width;
-        }
+static void tree_view_get(AppData *app_data, TreeView *view) {
+    double zoom = app_data->tree_zoom > 0 ? app_data->tree_zoom : 1.0;
+    double scroll_x = app_data->tree_hadjustment ? gtk_adjustment_get_value(app_data->tree_hadjustment) : 0.0;
+    double scroll_y = app_data->tree_vadjustment ? gtk_adjustment_get_value(app_data->tree_vadjustment) : 0.0;
+    view->zoom = zoom;
+    view->origin_x = 0.0;
+    view->origin_y = 0.0;
 
-        // Recalculer avec la largeur finale pour s'assurer que tout est visible
-        // Utiliser le viewport pour le calcul de l'espacement (branches courtes)
-        double final_x_spacing = compute_nary_spacing(tree_size, app_data->nary_max_children, (double)viewport_width);
-        double final_start_x = (double)required_width / 2.0;
-        calculate_nary_tree_bounds(app_data->nary_root, final_start_x, start_y, final_x_spacing, &min_x, &max_x, &max_y);
+    TreeRect bounds;
+    if (!tree_content_bounds(app_data, &bounds)) return;
+    double width, height;
+    tree_viewport_size(app_data, &width, &height);
 
-        // Recalculer required_width avec les nouvelles bornes (padding réduit)
-        actual_width = max_x - min_x;
-        required_width = (int)(actual_width + 150); // Padding réduit
-        if (min_x < 0) {
-            double min_x_abs = -min_x;
-            required_width = (int)(max_x + min_x_abs + 150);
-        }
-        // S'assurer que required_width est au moins estimated_width
-        if (required_width < (int)estimated_width) {
-            required_width = (int)estimated_width;
-        }
+    double content_width = (bounds.x2 - bounds.x1) * zoom;
+    if (content_width <= width) {
+        view->origin_x = (width - content_width) / 2.0 - bounds.x1 * zoom; // Centrer un arbre étroit
     } else {
-        required_width = viewport_width;
-        required_height = viewport_height;
+        view->origin_x = -bounds.x1 * zoom - scroll_x;
     }
+    view->origin_y = -bounds.y1 * zoom - scroll_y;
+}
 
-    // S'assurer que la taille est au moins celle du viewport
-    if (required_width < viewport_width) required_width = viewport_width;
-    if (required_height < viewport_height) required_height = viewport_height;
-
-    // Limite maximale raisonnable pour éviter les problèmes de mémoire (mais assez grande)
-    if (required_width > 50000) required_width = 50000;
-    if (required_height > 50000) required_height = 50000;
-
-    gtk_widget_set_size_request(app_data->tree_drawing_area, required_width, required_height);
+// --- Mettre à jour les barres de défilement en fonction de l'arbre et du zoom ---
+// Le défilement est virtuel: la zone de dessin garde la taille de la fenêtre et les
+// ajustements couvrent l'arbre entier à l'échelle courante, sans limite de taille
+static gboolean update_tree_scrollbars(gpointer data) {
+    AppData *app_data = (AppData *)data;
+    if (!app_data || !app_data->tree_drawing_area || !app_data->tree_hadjustment) return FALSE;
+
+    double width, height;
+    tree_viewport_size(app_data, &width, &height);
+
+    double content_width = 0.0, content_height = 0.0;
+    TreeRect bounds;
+    if (tree_content_bounds(app_data, &bounds)) {
+        // Un arbre devenu plus petit ne doit pas rester perdu au milieu de la vue
+        double min_zoom = tree_zoom_min(app_data);
+        if (app_data->tree_zoom < min_zoom) app_data->tree_zoom = min_zoom;
+        content_width = (bounds.x2 - bounds.x1) * app_data->tree_zoom;
+        content_height = (bounds.y2 - bounds.y1) * app_data->tree_zoom;
+    }
+
+    // Ne reconfigurer que si quelque chose a changé: appelé à chaque dessin
+    GtkAdjustment *adjustments[2] = {app_data->tree_hadjustment, app_data->tree_vadjustment};
+    double uppers[2] = {fmax(content_width, width), fmax(content_height, height)};
+    double pages[2] = {width, height};
+    for (int i = 0; i < 2; i++) {
+        GtkAdjustment *adj = adjustments[i];
+        if (gtk_adjustment_get_upper(adj) == uppers[i] && gtk_adjustment_get_page_size(adj) == pages[i]) continue;
+        double value = fmin(gtk_adjustment_get_value(adj), uppers[i] - pages[i]);
+        gtk_adjustment_configure(adj, fmax(0.0, value), 0.0, uppers[i], 40.0, pages[i] * 0.9, pages[i]);
+    }
     return FALSE; // Ne pas répéter
 }
 
 static gboolean draw_tree_callback(GtkWidget *widget, cairo_t *cr, gpointer data) {
     AppData *app_data = (AppData *)data;
 
-    // Mettre à jour la taille AVANT le dessin
-    update_tree_drawing_area_size(app_data);
+    // Mettre à jour le défilement AVANT le dessin
+    update_tree_scrollbars(app_data);
 
     guint width = gtk_widget_get_allocated_width(widget);
     guint height = gtk_widget_get_allocated_height(widget);
 
-    // Pour les arbres N-aire, avec l'espacement réduit, l'arbre devrait être plus compact
-    // Utiliser la largeur réelle allouée qui devrait être suffisante maintenant
-
     cairo_set_source_rgb(cr, 0.1, 0.1, 0.12); // #1a1a1f Dark BG
     cairo_paint(cr);
     cairo_set_source_rgb(cr, 1.0, 1.0, 1.0); // White lines
 
-    // Vérifier la taille pour décider si on dessine
-    int tree_size = 0;
-    if (app_data->tree_is_nary == 0 && app_data->binary_root) {
-        tree_size = binary_size(app_data->binary_root);
-    } else if (app_data->tree_is_nary == 1 && app_data->nary_root) {
-        tree_size = nary_size(app_data->nary_root);
-    }
-
-    // Dessiner l'arbre sans limitation de taille
-    if (tree_size > 0) {
-        double start_y = 40.0;
-
-        if (app_data->tree_is_nary == 0 && app_data->binary_root) {
-            // Pour les arbres binaires, utiliser le centre de la largeur réelle
-            double start_x = (width > 0) ? width / 2.0 : 400.0;
-            draw_binary_tree_improved(cr, app_data->binary_root, start_x, start_y, "Entiers (Int)");
-        } else if (app_data->tree_is_nary == 1 && app_data->nary_root) {
-            int tree_size = nary_size(app_data->nary_root);
-
-            // Obtenir la largeur du viewport pour le calcul de l'espacement
-            guint viewport_width = 800;
-            if (app_data->tree_scrolled_window) {
-                GtkAllocation allocation;
-                gtk_widget_get_allocation(app_data->tree_scrolled_window, &allocation);
-                viewport_width = allocation.width > 0 ? allocation.width : 800;
-            }
-
-            // Utiliser le viewport directement pour calculer l'espacement (branches courtes)
-            // Cela garantit que les branches sont courtes et visibles à l'écran
-            double x_spacing = compute_nary_spacing(tree_size, app_data->nary_max_children, (double)viewport_width);
+    TreeRect bounds;
+    if (tree_content_bounds(app_data, &bounds)) {
+        TreeView view;
+        tree_view_get(app_data, &view);
 
-            // Utiliser la largeur réelle du drawing_area pour centrer l'arbre
-            double drawing_width = (width > 0) ? (double)width : (double)viewport_width;
-            double start_x = drawing_width / 2.0;
+        // Passer dans le repère de la disposition: la zone à redessiner y donne le rectangle visible
+        cairo_save(cr);
+        cairo_translate(cr, view.origin_x, view.origin_y);
+        cairo_scale(cr, view.zoom, view.zoom);
+        TreeRect clip;
+        cairo_clip_extents(cr, &clip.x1, &clip.y1, &clip.x2, &clip.y2);
 
-            // Dessiner l'arbre avec des branches courtes et compactes
-            draw_nary_node_recursive(cr, app_data->nary_root, start_x, start_y, x_spacing, "Entiers (Int)");
+        if (app_data->tree_is_nary == 0) {
+            draw_binary_tree_improved(cr, app_data, view.zoom, &clip, "Entiers (Int)");
+        } else {
+            draw_nary_tree_cached(cr, app_data, view.zoom, &clip, "Entiers (Int)");
         }
+        cairo_restore(cr);
     } else {
         // Arbre vide
         cairo_set_source_rgb(cr, 1.0, 1.0, 1.0);
@@ -5744,6 +10455,27 @@ static gboolean draw_tree_callback(GtkWidget *widget, cairo_t *cr, gpointer data
     return TRUE;
 }
 
+// --- Zoom autour d'un point de l'écran (le point de l'arbre sous le pointeur reste en place) ---
+static void tree_set_zoom(AppData *app_data, double zoom, double screen_x, double screen_y) {
+    if (!app_data->tree_drawing_area) return;
+    TreeView view;
+    tree_view_get(app_data, &view);
+    double layout_x = (screen_x - view.origin_x) / view.zoom;
+    double layout_y = (screen_y - view.origin_y) / view.zoom;
+
+    zoom = fmin(TREE_ZOOM_MAX, fmax(tree_zoom_min(app_data), zoom));
+    app_data->tree_zoom = zoom;
+    app_data->tree_hover_node = NULL; // Les positions à l'écran ont changé
+    update_tree_scrollbars(app_data);
+
+    TreeRect bounds;
+    if (app_data->tree_hadjustment && tree_content_bounds(app_data, &bounds)) {
+        gtk_adjustment_set_value(app_data->tree_hadjustment, (layout_x - bounds.x1) * zoom - screen_x);
+        gtk_adjustment_set_value(app_data->tree_vadjustment, (layout_y - bounds.y1) * zoom - screen_y);
+    }
+    gtk_widget_queue_draw(app_data->tree_drawing_area);
+}
+
 // --- Callbacks ---
 static void on_tree_input_source_toggled(GtkWidget *widget, gpointer data) {
     AppData *app_data = (AppData *)data;
@@ -5790,6 +10522,25 @@ static void on_tree_input_source_toggled(GtkWidget *widget, gpointer data) {
     }
 }
 
+// Lit le menu "Type d'Arbre" (0: Binaire, 1: N-Aire, 2: AVL, 3: Rouge-Noir).
+// Un arbre binaire existant est reconstruit si son équilibrage change.
+static void tree_read_type(AppData *app_data) {
+    int active = gtk_combo_box_get_active(GTK_COMBO_BOX(app_data->tree_type_combo));
+    app_data->tree_is_nary = (active == 1);
+    if (app_data->tree_is_nary) return;
+
+    TreeBalance balance = active == 2 ? TREE_BALANCE_AVL : active == 3 ? TREE_BALANCE_RB : TREE_BALANCE_NONE;
+    if (balance != app_data->tree_balance && app_data->binary_root) {
+        BinaryNode *rebuilt = NULL;
+        binary_reinsert_all(app_data->binary_root, &rebuilt, balance);
+        free_binary_tree(app_data->binary_root);
+        app_data->binary_root = rebuilt;
+        app_data->binary_unordered = FALSE; // Réinsérées une à une: de nouveau un ABR
+        binary_layout_invalidate(app_data);
+    }
+    app_data->tree_balance = balance;
+}
+
 static void on_tree_create_clicked(GtkWidget *widget, gpointer data) {
     AppData *app_data = (AppData *)data;
     // Clear existing
@@ -5797,12 +10548,17 @@ static void on_tree_create_clicked(GtkWidget *widget, gpointer data) {
         free_binary_tree(app_data->binary_root);
         app_data->binary_root = NULL;
     }
+    app_data->binary_unordered = FALSE;
+    binary_layout_invalidate(app_data);
     if (app_data->nary_root) {
         free_nary_tree(app_data->nary_root);
         app_data->nary_root = NULL;
     }
+    app_data->nary_count = 0;
+    nary_frontier_invalidate(&app_data->nary_frontier);
+    nary_layout_invalidate(app_data);
 
-    app_data->tree_is_nary = gtk_combo_box_get_active(GTK_COMBO_BOX(app_data->tree_type_combo));
+    tree_read_type(app_data);
     app_data->nary_max_children = app_data->tree_nary_degree_input
         ? gtk_spin_button_get_value_as_int(app_data->tree_nary_degree_input)
         : 3;
@@ -5824,28 +10580,42 @@ static void on_tree_insert_random_clicked(GtkWidget *widget, gpointer data) {
         app_data->nary_max_children = gtk_spin_button_get_value_as_int(app_data->tree_nary_degree_input);
         if (app_data->nary_max_children < 1) app_data->nary_max_children = 1;
     }
-    app_data->tree_is_nary = gtk_combo_box_get_active(GTK_COMBO_BOX(app_data->tree_type_combo));
+    tree_read_type(app_data);
 
     int (*cmp)(const void*, const void*) = compare_int;
+    int inserted = n;
 
     if (app_data->tree_is_nary == 0) {
+        // Les doublons étant ignorés, tirer dans un intervalle dix fois plus large que n
+        // pour que l'arbre atteigne à peu près la taille demandée
+        guint32 range = MAX(100, 10 * (guint32)n);
+        int size_before = binary_size(app_data->binary_root);
         for(int i=0; i<n; i++) {
-            int val = rand() % 100;
-            app_data->binary_root = insert_binary(app_data->binary_root, &val, cmp, sizeof(int));
+            int val = (int)list_random_below(range);
+            app_data->binary_root = insert_binary_balanced(app_data->binary_root, &val, cmp, sizeof(int), app_data->tree_balance);
         }
+        inserted = binary_size(app_data->binary_root) - size_before;
+        binary_layout_invalidate(app_data);
     } else {
         for(int i=0; i<n; i++) {
             int val = rand() % 100;
-            app_data->nary_root = insert_nary_random(app_data->nary_root, &val, sizeof(int), app_data->nary_max_children);
+            app_data->nary_root = insert_nary_random(app_data->nary_root, &app_data->nary_frontier, &val, sizeof(int),
+                                                     app_data->nary_max_children);
         }
+        app_data->nary_count += n;
+        nary_layout_invalidate(app_data);
     }
 
     // Forcer le redimensionnement avant le dessin pour les grands arbres
-    g_idle_add((GSourceFunc)update_tree_drawing_area_size, app_data);
+    g_idle_add((GSourceFunc)update_tree_scrollbars, app_data);
     gtk_widget_queue_draw(app_data->tree_drawing_area);
 
     GtkTextBuffer *buffer = gtk_text_view_get_buffer(app_data->tree_info_view);
-    gtk_text_buffer_set_text(buffer, g_strdup_printf("Insertion aléatoire de %d éléments terminée.", n), -1);
+    if (inserted < n) {
+        gtk_text_buffer_set_text(buffer, g_strdup_printf("Insertion aléatoire terminée: %d nouveaux éléments sur %d tirés (doublons ignorés).", inserted, n), -1);
+    } else {
+        gtk_text_buffer_set_text(buffer, g_strdup_printf("Insertion aléatoire de %d éléments terminée.", n), -1);
+    }
 }
 
 static void on_tree_traversal_execute(GtkWidget *widget, gpointer data) {
@@ -5930,13 +10700,28 @@ static void on_tree_stats_clicked(GtkWidget *widget, gpointer data) {
     if (app_data->tree_is_nary == 0 && app_data->binary_root) {
         int depth = binary_depth(app_data->binary_root);
         int size = binary_size(app_data->binary_root);
-        gchar *msg = g_strdup_printf("Statistiques Arbre Binaire:\nTaille: %d\nProfondeur: %d", size, depth);
+        // Hauteur minimale possible pour n nœuds: ceil(log2(n+1))
+        int optimal = 0;
+        while ((1LL << optimal) - 1 < size) optimal++;
+        gchar *msg;
+        if (app_data->tree_balance == TREE_BALANCE_AVL) {
+            msg = g_strdup_printf("Statistiques Arbre AVL:\nTaille: %d\nHauteur: %d (minimum possible: %d)\nÉquilibre racine: %d",
+                                  size, depth, optimal,
+                                  binary_node_height(app_data->binary_root->left) - binary_node_height(app_data->binary_root->right));
+        } else if (app_data->tree_balance == TREE_BALANCE_RB) {
+            msg = g_strdup_printf("Statistiques Arbre Rouge-Noir:\nTaille: %d\nHauteur: %d (minimum possible: %d)\nHauteur noire: %d",
+                                  size, depth, optimal, rb_black_height(app_data->binary_root));
+        } else {
+            msg = g_strdup_printf("Statistiques Arbre Binaire:\nTaille: %d\nProfondeur: %d (minimum possible: %d)", size, depth, optimal);
+        }
         GtkTextBuffer *buffer = gtk_text_view_get_buffer(app_data->tree_info_view);
         gtk_text_buffer_set_text(buffer, msg, -1);
         g_free(msg);
     } else if (app_data->tree_is_nary == 1 && app_data->nary_root) {
-        int depth = nary_depth(app_data->nary_root);
-        int size = nary_size(app_data->nary_root);
+        // Taille tenue à jour; profondeur lue dans la disposition en cache
+        nary_layout_ensure(app_data);
+        int depth = (int)(app_data->nary_layout_max_y / VERTICAL_SPACING + 0.5) + 1;
+        int size = app_data->nary_count;
         gchar *msg = g_strdup_printf("Statistiques Arbre N-Aire:\nTaille: %d\nProfondeur: %d", size, depth);
         GtkTextBuffer *buffer = gtk_text_view_get_buffer(app_data->tree_info_view);
         gtk_text_buffer_set_text(buffer, msg, -1);
@@ -5947,12 +10732,78 @@ static void on_tree_stats_clicked(GtkWidget *widget, gpointer data) {
     }
 }
 
+// --- Requêtes d'ordre (k-ième, rang, intervalle) ---
+// Descente unique guidée par les tailles de sous-arbres: O(hauteur), O(log n) en AVL / Rouge-Noir
+static gboolean tree_order_query_available(AppData *app_data) {
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(app_data->tree_info_view);
+    if (app_data->tree_is_nary == 0 && app_data->binary_root) {
+        if (!app_data->binary_unordered) return TRUE;
+        gtk_text_buffer_set_text(buffer, "L'arbre binaire n'est plus un arbre de recherche: utilisez \"Ordonner Arbre\" avant les requêtes d'ordre.", -1);
+        return FALSE;
+    }
+    gtk_text_buffer_set_text(buffer, "Requêtes d'ordre disponibles uniquement pour un arbre binaire de recherche non vide.", -1);
+    return FALSE;
+}
+
+static void on_tree_select_clicked(GtkWidget *widget, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    if (!tree_order_query_available(app_data)) return;
+
+    int n = binary_size(app_data->binary_root);
+    int k = get_integer_input(gtk_widget_get_toplevel(widget), "k-ième plus petit", "k (1 = minimum):", 1);
+    BinaryNode *node = binary_select(app_data->binary_root, k);
+
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(app_data->tree_info_view);
+    if (node) {
+        gtk_text_buffer_set_text(buffer, g_strdup_printf("%d-ième plus petite valeur: %d (sur %d)", k, *(int*)node->data, n), -1);
+    } else {
+        gtk_text_buffer_set_text(buffer, g_strdup_printf("k doit être entre 1 et %d.", n), -1);
+    }
+}
+
+static void on_tree_rank_clicked(GtkWidget *widget, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    if (!tree_order_query_available(app_data)) return;
+
+    int val = get_integer_input(gtk_widget_get_toplevel(widget), "Rang", "Valeur:", 0);
+    int below = binary_count_below(app_data->binary_root, val, FALSE);
+    gboolean present = binary_count_below(app_data->binary_root, val, TRUE) > below;
+
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(app_data->tree_info_view);
+    if (present) {
+        gtk_text_buffer_set_text(buffer, g_strdup_printf("Rang de %d: %d (sur %d)", val, below + 1, binary_size(app_data->binary_root)), -1);
+    } else {
+        gtk_text_buffer_set_text(buffer, g_strdup_printf("Valeur %d absente: %d valeurs plus petites.", val, below), -1);
+    }
+}
+
+static void on_tree_range_count_clicked(GtkWidget *widget, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    if (!tree_order_query_available(app_data)) return;
+
+    int a = get_integer_input(gtk_widget_get_toplevel(widget), "Intervalle", "Borne inférieure a:", 0);
+    int b = get_integer_input(gtk_widget_get_toplevel(widget), "Intervalle", "Borne supérieure b:", 100);
+    if (a > b) { int t = a; a = b; b = t; }
+    int count = binary_count_below(app_data->binary_root, b, TRUE) - binary_count_below(app_data->binary_root, a, FALSE);
+
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(app_data->tree_info_view);
+    gtk_text_buffer_set_text(buffer, g_strdup_printf("Valeurs dans [%d, %d]: %d", a, b, count), -1);
+}
+
 // --- Ordonner un arbre binaire (reconstruire en ordre) ---
 static void collect_inorder(BinaryNode *root, int *values, int *index) {
-    if (!root) return;
-    collect_inorder(root->left, values, index);
-    values[(*index)++] = *(int*)root->data;
-    collect_inorder(root->right, values, index);
+    TreeStack stack = {0};
+    BinaryNode *node = root;
+    while (node || stack.count) {
+        while (node) {
+            tree_stack_push(&stack, node);
+            node = node->left;
+        }
+        node = tree_stack_pop(&stack);
+        values[(*index)++] = *(int*)node->data;
+        node = node->right;
+    }
+    tree_stack_free(&stack);
 }
 
 static BinaryNode *build_balanced_bst(int *values, int start, int end) {
@@ -5965,6 +10816,7 @@ static BinaryNode *build_balanced_bst(int *values, int start, int end) {
 
     node->left = build_balanced_bst(values, start, mid - 1);
     node->right = build_balanced_bst(values, mid + 1, end);
+    binary_node_update(node);
 
     return node;
 }
@@ -5990,9 +10842,20 @@ static void on_tree_order_clicked(GtkWidget *widget, gpointer data) {
 
         // Reconstruire l'arbre équilibré
         if (app_data->binary_root) free_binary_tree(app_data->binary_root);
-        app_data->binary_root = build_balanced_bst(values, 0, size - 1);
+        if (app_data->tree_balance == TREE_BALANCE_RB) {
+            // Les nœuds rouges doivent rester des fils gauches: reconstruire par insertions
+            app_data->binary_root = NULL;
+            for (int i = 0; i < size; i++) {
+                app_data->binary_root = insert_rb(app_data->binary_root, &values[i], compare_int, sizeof(int));
+            }
+        } else {
+            // Déjà équilibré à 1 près: valide aussi comme AVL
+            app_data->binary_root = build_balanced_bst(values, 0, size - 1);
+        }
 
         free(values);
+        app_data->binary_unordered = FALSE;
+        binary_layout_invalidate(app_data);
 
         gtk_widget_queue_draw(app_data->tree_drawing_area);
 
@@ -6009,11 +10872,15 @@ static void on_tree_transform_clicked(GtkWidget *widget, gpointer data) {
     if (app_data->tree_is_nary == 1 && app_data->nary_root) {
         // Convert N-Ary to Binary
         BinaryNode *new_root = convert_nary_to_binary(app_data->nary_root, sizeof(int));
+        binary_annotate(new_root);
 
         // Switch mode
         app_data->tree_is_nary = 0;
+        app_data->tree_balance = TREE_BALANCE_NONE; // Fils gauche / frère droit: pas un ABR
         if (app_data->binary_root) free_binary_tree(app_data->binary_root);
         app_data->binary_root = new_root;
+        app_data->binary_unordered = TRUE;
+        binary_layout_invalidate(app_data);
 
         // Update UI
         gtk_combo_box_set_active(GTK_COMBO_BOX(app_data->tree_type_combo), 0); // Set to Binaire
@@ -6028,55 +10895,112 @@ static void on_tree_transform_clicked(GtkWidget *widget, gpointer data) {
 }
 
 // --- Delete/Modify Helpers ---
-static BinaryNode *find_min(BinaryNode *node) {
-    while (node->left) node = node->left;
-    return node;
+static BinaryNode *delete_binary_node(BinaryNode *root, int val) {
+    // Descente par le lien parent -> enfant, sans récursion; les ancêtres du nœud
+    // retiré sont mémorisés pour remettre à jour leur taille et leur hauteur
+    TreeStack path = {0};
+    BinaryNode **link = &root;
+    while (*link && *(int*)(*link)->data != val) {
+        tree_stack_push(&path, *link);
+        link = val < *(int*)(*link)->data ? &(*link)->left : &(*link)->right;
+    }
+    BinaryNode *target = *link;
+    if (!target) {
+        tree_stack_free(&path);
+        return root;
+    }
+
+    if (target->left && target->right) {
+        // Deux enfants: copier le successeur (minimum à droite), qui n'a pas de fils gauche
+        tree_stack_push(&path, target);
+        BinaryNode **succ_link = &target->right;
+        while ((*succ_link)->left) {
+            tree_stack_push(&path, *succ_link);
+            succ_link = &(*succ_link)->left;
+        }
+        BinaryNode *succ = *succ_link;
+        *(int*)target->data = *(int*)succ->data; // Copy data
+        *succ_link = succ->right;
+        free(succ->data); free(succ);
+    } else {
+        *link = target->left ? target->left : target->right;
+        free(target->data); free(target);
+    }
+    binary_update_path(&path);
+    return root;
 }
 
-static BinaryNode *delete_binary_node(BinaryNode *root, int val) {
-    if (!root) return NULL;
+static BinaryNode *delete_binary_balanced(BinaryNode *root, int val, TreeBalance balance) {
+    switch (balance) {
+        case TREE_BALANCE_AVL: return delete_avl(root, val);
+        case TREE_BALANCE_RB: return delete_rb(root, val);
+        default: return delete_binary_node(root, val);
+    }
+}
 
-    int root_val = *(int*)root->data;
-    if (val < root_val) root->left = delete_binary_node(root->left, val);
-    else if (val > root_val) root->right = delete_binary_node(root->right, val);
-    else {
-        // Node found
-        if (!root->left) {
-            BinaryNode *temp = root->right;
-            free(root->data); free(root);
-            return temp;
-        } else if (!root->right) {
-            BinaryNode *temp = root->left;
-            free(root->data); free(root);
-            return temp;
-        }
-        BinaryNode *temp = find_min(root->right);
-        *(int*)root->data = *(int*)temp->data; // Copy data
-        root->right = delete_binary_node(root->right, *(int*)temp->data);
+typedef enum {
+    TREE_MODIFY_OK,
+    TREE_MODIFY_NOT_FOUND,
+    TREE_MODIFY_DUPLICATE
+} TreeModifyResult;
+
+static BinaryNode *binary_find(BinaryNode *node, int val) {
+    while (node && *(int*)node->data != val) {
+        node = val < *(int*)node->data ? node->left : node->right;
     }
-    return root;
+    return node;
 }
 
-static NaryNode *delete_nary_node(NaryNode *root, int val) {
-    if (!root) return NULL;
+// AVL / Rouge-Noir: changer une valeur en place casserait l'ordre et l'équilibre,
+// on supprime puis réinsère. Les doublons étant ignorés à l'insertion, une
+// new_val déjà présente est refusée avant de supprimer old_val.
+static TreeModifyResult modify_binary_balanced(AppData *app_data, int old_val, int new_val) {
+    if (!binary_find(app_data->binary_root, old_val)) return TREE_MODIFY_NOT_FOUND;
+    if (new_val == old_val) return TREE_MODIFY_OK;
+    if (binary_find(app_data->binary_root, new_val)) return TREE_MODIFY_DUPLICATE;
+
+    app_data->binary_root = delete_binary_balanced(app_data->binary_root, old_val, app_data->tree_balance);
+    app_data->binary_root = insert_binary_balanced(app_data->binary_root, &new_val, compare_int, sizeof(int), app_data->tree_balance);
+    return TREE_MODIFY_OK;
+}
 
-    // Check root
+// removed reçoit le nombre de nœuds libérés (nœud trouvé et tout son sous-arbre)
+static NaryNode *delete_nary_node(NaryNode *root, int val, int *removed) {
+    if (!root) return NULL;
     if (*(int*)root->data == val) {
-        // Remove this node and its entire subtree
-        // FIX: Detach next_sibling so it is not freed
-        NaryNode *siblings = root->next_sibling;
-        root->next_sibling = NULL;
+        *removed += nary_size(root);
         free_nary_tree(root);
-        return siblings;
+        return NULL;
     }
 
-    // Check children (siblings of first_child)
-    if (root->first_child) {
-        root->first_child = delete_nary_node(root->first_child, val);
+    // Pile de parents dont la liste d'enfants reste à examiner: le parent connu,
+    // child_count et last_child restent à jour après chaque retrait
+    TreeStack stack = {0};
+    tree_stack_push(&stack, root);
+    while (stack.count) {
+        NaryNode *parent = tree_stack_pop(&stack);
+        NaryNode *prev = NULL;
+        NaryNode *child = parent->first_child;
+        while (child) {
+            NaryNode *next = child->next_sibling;
+            if (*(int*)child->data == val) {
+                // Remove this node and its entire subtree
+                // FIX: Detach next_sibling so it is not freed
+                if (prev) prev->next_sibling = next;
+                else parent->first_child = next;
+                child->next_sibling = NULL;
+                parent->child_count--;
+                *removed += nary_size(child);
+                free_nary_tree(child);
+            } else {
+                tree_stack_push(&stack, child);
+                prev = child;
+            }
+            child = next;
+        }
+        parent->last_child = prev;
     }
-    // Check next sibling
-    root->next_sibling = delete_nary_node(root->next_sibling, val);
-
+    tree_stack_free(&stack);
     return root;
 }
 
@@ -6086,8 +11010,9 @@ static void on_tree_delete_clicked(GtkWidget *widget, gpointer data) {
 
     if (app_data->tree_is_nary == 0 && app_data->binary_root) {
         int size_before = binary_size(app_data->binary_root);
-        app_data->binary_root = delete_binary_node(app_data->binary_root, val);
+        app_data->binary_root = delete_binary_balanced(app_data->binary_root, val, app_data->tree_balance);
         int size_after = binary_size(app_data->binary_root);
+        binary_layout_invalidate(app_data);
 
         gtk_widget_queue_draw(app_data->tree_drawing_area);
         GtkTextBuffer *buffer = gtk_text_view_get_buffer(app_data->tree_info_view);
@@ -6097,13 +11022,15 @@ static void on_tree_delete_clicked(GtkWidget *widget, gpointer data) {
             gtk_text_buffer_set_text(buffer, g_strdup_printf("Valeur %d non trouvée dans l'arbre binaire.", val), -1);
         }
     } else if (app_data->tree_is_nary == 1 && app_data->nary_root) {
-        int size_before = nary_size(app_data->nary_root);
-        app_data->nary_root = delete_nary_node(app_data->nary_root, val);
-        int size_after = nary_size(app_data->nary_root);
+        int removed = 0;
+        app_data->nary_root = delete_nary_node(app_data->nary_root, val, &removed);
+        app_data->nary_count -= removed;
+        if (removed > 0) nary_frontier_invalidate(&app_data->nary_frontier); // Nœuds libérés encore dans la file
+        nary_layout_invalidate(app_data);
 
         gtk_widget_queue_draw(app_data->tree_drawing_area);
         GtkTextBuffer *buffer = gtk_text_view_get_buffer(app_data->tree_info_view);
-        if (size_before > size_after) {
+        if (removed > 0) {
             gtk_text_buffer_set_text(buffer, g_strdup_printf("Valeur %d supprimée de l'arbre N-Aire.", val), -1);
         } else {
             gtk_text_buffer_set_text(buffer, g_strdup_printf("Valeur %d non trouvée dans l'arbre N-Aire.", val), -1);
@@ -6115,127 +11042,140 @@ static void on_tree_delete_clicked(GtkWidget *widget, gpointer data) {
 }
 
 // --- Fonctions pour trouver le nœud cliqué ---
+// Le point de l'écran est ramené dans le repère de la disposition, où le rayon d'un nœud
+// ne dépend pas du zoom
 static BinaryNode* find_clicked_binary_node(AppData *app_data, double click_x, double click_y) {
     if (!app_data->binary_root) return NULL;
 
-    guint width = gtk_widget_get_allocated_width(app_data->tree_drawing_area);
-    double start_x = (width > 0) ? width / 2.0 : 400.0;
-    double start_y = 40.0;
+    binary_layout_ensure(app_data);
+    if (app_data->binary_layout_count == 0) return NULL;
+    TreeView view;
+    tree_view_get(app_data, &view);
+    double x = (click_x - view.origin_x) / view.zoom;
+    double y = (click_y - view.origin_y) / view.zoom;
 
-    int node_count = binary_size(app_data->binary_root);
-    if (node_count == 0) return NULL;
-
-    // Construire le map des positions
-    NodePosMap *map = g_new0(NodePosMap, node_count);
-    int map_index = 0;
-    double cursor_x = 0.0;
-    assign_binary_positions(app_data->binary_root, map, &map_index, &cursor_x, start_y, 0);
-
-    // Centrer l'arbre horizontalement
-    if (node_count > 0) {
-        double min_x = map[0].x;
-        double max_x = map[0].x;
-        for (int i = 1; i < node_count; i++) {
-            if (map[i].x < min_x) min_x = map[i].x;
-            if (map[i].x > max_x) max_x = map[i].x;
-        }
-        double center_offset = start_x - (min_x + max_x) / 2.0;
-        for (int i = 0; i < node_count; i++) {
-            map[i].x += center_offset;
-        }
-    }
-
-    // Trouver le nœud cliqué
-    BinaryNode *clicked_node = NULL;
-    double min_distance = NODE_RADIUS * NODE_RADIUS; // Distance au carré pour éviter sqrt
-    for (int i = 0; i < node_count; i++) {
-        double dx = click_x - map[i].x;
-        double dy = click_y - map[i].y;
-        double distance_sq = dx * dx + dy * dy;
-        if (distance_sq < min_distance) {
-            min_distance = distance_sq;
-            clicked_node = map[i].node;
-        }
-    }
+    // Une colonne par nœud (rang infixe), plus large que le diamètre d'un nœud:
+    // seul le nœud de la colonne la plus proche peut contenir le clic
+    double column = (x + app_data->binary_layout_half_width) / HORIZONTAL_SPACING;
+    int index = (int)floor(column + 0.5);
+    if (index < 0 || index >= app_data->binary_layout_count) return NULL;
 
-    g_free(map);
-    return clicked_node;
+    BinaryNode *node = app_data->binary_layout_nodes[index];
+    double dx = x - node->x;
+    double dy = y - node->y;
+    return (dx * dx + dy * dy < NODE_RADIUS * NODE_RADIUS) ? node : NULL; // Distance au carré pour éviter sqrt
 }
 
 static NaryNode* find_clicked_nary_node(AppData *app_data, double click_x, double click_y) {
     if (!app_data->nary_root) return NULL;
 
-    guint width = gtk_widget_get_allocated_width(app_data->tree_drawing_area);
-    double start_x = (width > 0) ? width / 2.0 : 400.0;
-    double start_y = 40.0;
-    double viewport_width = (width > 0) ? width : 800.0;
-    int tree_size = nary_size(app_data->nary_root);
-    double x_spacing = compute_nary_spacing(tree_size, app_data->nary_max_children, viewport_width);
+    nary_layout_ensure(app_data);
+    TreeView view;
+    tree_view_get(app_data, &view);
+    double x = (click_x - view.origin_x) / view.zoom;
+    double y = (click_y - view.origin_y) / view.zoom;
 
-    // Construire le map des positions
-    int node_count = nary_size(app_data->nary_root);
-    if (node_count == 0) return NULL;
+    // Le niveau se déduit de l'ordonnée (espacement vertical > diamètre d'un nœud)
+    int level = (int)floor(y / VERTICAL_SPACING + 0.5);
+    if (level < 0 || level >= app_data->nary_layout_levels) return NULL;
 
-    NaryNodePosMap *map = g_new0(NaryNodePosMap, node_count);
-    int map_index = 0;
-    assign_nary_positions(app_data->nary_root, map, &map_index, start_x, start_y, x_spacing);
+    // Recherche dichotomique du premier nœud de la rangée à droite du clic:
+    // seuls lui et son voisin de gauche peuvent contenir le point
+    NaryNode **row = app_data->nary_layout_nodes;
+    int lo = app_data->nary_layout_row_start[level];
+    int row_end = app_data->nary_layout_row_start[level + 1];
+    int row_begin = lo, hi = row_end;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (row[mid]->x < x) lo = mid + 1;
+        else hi = mid;
+    }
 
-    // Trouver le nœud cliqué
     NaryNode *clicked_node = NULL;
     double min_distance = NODE_RADIUS * NODE_RADIUS; // Distance au carré pour éviter sqrt
-    for (int i = 0; i < node_count; i++) {
-        double dx = click_x - map[i].x;
-        double dy = click_y - map[i].y;
+    for (int i = lo - 1; i <= lo; i++) {
+        if (i < row_begin || i >= row_end) continue;
+        NaryNode *node = row[i];
+        double dx = x - node->x;
+        double dy = y - node->y;
         double distance_sq = dx * dx + dy * dy;
         if (distance_sq < min_distance) {
             min_distance = distance_sq;
-            clicked_node = map[i].node;
+            clicked_node = node;
         }
     }
 
-    g_free(map);
     return clicked_node;
 }
 
 // Fonction helper pour trouver et modifier un nœud Binaire
-static gboolean modify_binary_node(BinaryNode *root, int old_val, int new_val) {
-    if (!root) return FALSE;
-
-    if (*(int*)root->data == old_val) {
-        *(int*)root->data = new_val;
-        return TRUE;
+// Dans un ABR, old_val peut devenir new_val sur place si new_val reste strictement
+// entre le prédécesseur et le successeur infixes du nœud (bornes héritées des ancêtres
+// ou extrêmes de ses sous-arbres)
+static gboolean binary_value_keeps_order(BinaryNode *root, int old_val, int new_val) {
+    BinaryNode *node = root;
+    const int *lo = NULL, *hi = NULL;
+    while (node && *(int*)node->data != old_val) {
+        if (old_val < *(int*)node->data) {
+            hi = node->data;
+            node = node->left;
+        } else {
+            lo = node->data;
+            node = node->right;
+        }
     }
+    if (!node) return TRUE; // Rien ne sera modifié
 
-    // Chercher récursivement dans les sous-arbres
-    if (modify_binary_node(root->left, old_val, new_val)) {
-        return TRUE;
+    if (node->left) {
+        BinaryNode *pred = node->left;
+        while (pred->right) pred = pred->right;
+        lo = pred->data;
     }
-    if (modify_binary_node(root->right, old_val, new_val)) {
-        return TRUE;
+    if (node->right) {
+        BinaryNode *succ = node->right;
+        while (succ->left) succ = succ->left;
+        hi = succ->data;
     }
+    return (!lo || *lo < new_val) && (!hi || new_val < *hi);
+}
 
-    return FALSE;
+static gboolean modify_binary_node(BinaryNode *root, int old_val, int new_val) {
+    // Pré-ordre: le premier nœud trouvé est le même qu'en parcours récursif
+    TreeStack stack = {0};
+    gboolean found = FALSE;
+    if (root) tree_stack_push(&stack, root);
+    while (stack.count) {
+        BinaryNode *node = tree_stack_pop(&stack);
+        if (*(int*)node->data == old_val) {
+            *(int*)node->data = new_val;
+            found = TRUE;
+            break;
+        }
+        if (node->right) tree_stack_push(&stack, node->right);
+        if (node->left) tree_stack_push(&stack, node->left);
+    }
+    tree_stack_free(&stack);
+    return found;
 }
 
 // Fonction helper pour trouver et modifier un nœud N-Aire
 static gboolean modify_nary_node(NaryNode *root, int old_val, int new_val) {
-    if (!root) return FALSE;
-
-    if (*(int*)root->data == old_val) {
-        *(int*)root->data = new_val;
-        return TRUE;
-    }
-
-    // Chercher dans les enfants
-    NaryNode *child = root->first_child;
-    while (child) {
-        if (modify_nary_node(child, old_val, new_val)) {
-            return TRUE;
+    TreeStack stack = {0};
+    gboolean found = FALSE;
+    if (root) tree_stack_push(&stack, root);
+    while (stack.count) {
+        NaryNode *node = tree_stack_pop(&stack);
+        if (*(int*)node->data == old_val) {
+            *(int*)node->data = new_val;
+            found = TRUE;
+            break;
         }
-        child = child->next_sibling;
+        // Frère après les enfants (pré-ordre), frères de root exclus
+        if (node != root && node->next_sibling) tree_stack_push(&stack, node->next_sibling);
+        if (node->first_child) tree_stack_push(&stack, node->first_child);
     }
-
-    return FALSE;
+    tree_stack_free(&stack);
+    return found;
 }
 
 static void on_tree_modify_clicked(GtkWidget *widget, gpointer data) {
@@ -6245,10 +11185,23 @@ static void on_tree_modify_clicked(GtkWidget *widget, gpointer data) {
 
     if (app_data->tree_is_nary == 0 && app_data->binary_root) {
         // Binaire: trouver et modifier directement (sans changer la structure)
-        if (modify_binary_node(app_data->binary_root, old_val, new_val)) {
+        TreeModifyResult result;
+        if (app_data->tree_balance == TREE_BALANCE_NONE) {
+            if (!app_data->binary_unordered && !binary_value_keeps_order(app_data->binary_root, old_val, new_val)) {
+                app_data->binary_unordered = TRUE;
+            }
+            result = modify_binary_node(app_data->binary_root, old_val, new_val) ? TREE_MODIFY_OK : TREE_MODIFY_NOT_FOUND;
+        } else {
+            result = modify_binary_balanced(app_data, old_val, new_val);
+        }
+        if (result == TREE_MODIFY_OK) {
+            binary_layout_invalidate(app_data);
             gtk_widget_queue_draw(app_data->tree_drawing_area);
             GtkTextBuffer *buffer = gtk_text_view_get_buffer(app_data->tree_info_view);
             gtk_text_buffer_set_text(buffer, g_strdup_printf("Modification Binaire: %d -> %d", old_val, new_val), -1);
+        } else if (result == TREE_MODIFY_DUPLICATE) {
+            GtkTextBuffer *buffer = gtk_text_view_get_buffer(app_data->tree_info_view);
+            gtk_text_buffer_set_text(buffer, g_strdup_printf("Valeur %d déjà présente: modification refusée.", new_val), -1);
         } else {
             GtkTextBuffer *buffer = gtk_text_view_get_buffer(app_data->tree_info_view);
             gtk_text_buffer_set_text(buffer, g_strdup_printf("Valeur %d non trouvée dans l'arbre binaire.", old_val), -1);
@@ -6280,7 +11233,17 @@ static gboolean on_tree_click_event(GtkWidget *widget, GdkEventButton *event, gp
         if (clicked_node) {
             int current_val = *(int *)clicked_node->data;
             int new_val = get_integer_input(gtk_widget_get_toplevel(widget), "Modifier", "Nouvelle valeur:", current_val);
-            *(int *)clicked_node->data = new_val;
+            if (app_data->tree_balance == TREE_BALANCE_NONE) {
+                if (!app_data->binary_unordered && !binary_value_keeps_order(app_data->binary_root, current_val, new_val)) {
+                    app_data->binary_unordered = TRUE;
+                }
+                *(int *)clicked_node->data = new_val;
+            } else if (modify_binary_balanced(app_data, current_val, new_val) == TREE_MODIFY_DUPLICATE) {
+                GtkTextBuffer *buffer = gtk_text_view_get_buffer(app_data->tree_info_view);
+                gtk_text_buffer_set_text(buffer, g_strdup_printf("Valeur %d déjà présente: modification refusée.", new_val), -1);
+                return TRUE;
+            }
+            binary_layout_invalidate(app_data);
             gtk_widget_queue_draw(widget);
 
             GtkTextBuffer *buffer = gtk_text_view_get_buffer(app_data->tree_info_view);
@@ -6301,9 +11264,133 @@ static gboolean on_tree_click_event(GtkWidget *widget, GdkEventButton *event, gp
         }
     }
 
+    // Clic sur le fond: commencer à déplacer la vue
+    app_data->tree_panning = TRUE;
+    app_data->tree_pan_x = event->x;
+    app_data->tree_pan_y = event->y;
+    return TRUE;
+}
+
+// --- Survol: même index spatial que le clic, seule la zone des nœuds concernés est redessinée ---
+static void tree_set_hover(AppData *app_data, GtkWidget *widget, void *node, double x, double y) {
+    if (node == app_data->tree_hover_node) return;
+
+    TreeView view;
+    tree_view_get(app_data, &view);
+    int margin = (int)(fmax(NODE_RADIUS, 1.5 / view.zoom) * view.zoom) + 2;
+    if (app_data->tree_hover_node) {
+        gtk_widget_queue_draw_area(widget, (int)app_data->tree_hover_x - margin, (int)app_data->tree_hover_y - margin,
+                                   2 * margin, 2 * margin);
+    }
+    app_data->tree_hover_node = node;
+    app_data->tree_hover_x = x;
+    app_data->tree_hover_y = y;
+    if (node) gtk_widget_queue_draw_area(widget, (int)x - margin, (int)y - margin, 2 * margin, 2 * margin);
+}
+
+static gboolean on_tree_motion_event(GtkWidget *widget, GdkEventMotion *event, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    if (!app_data) return FALSE;
+
+    // Glisser sur le fond: déplacer la vue
+    if (app_data->tree_panning) {
+        if (app_data->tree_hadjustment) {
+            gtk_adjustment_set_value(app_data->tree_hadjustment,
+                                     gtk_adjustment_get_value(app_data->tree_hadjustment) - (event->x - app_data->tree_pan_x));
+            gtk_adjustment_set_value(app_data->tree_vadjustment,
+                                     gtk_adjustment_get_value(app_data->tree_vadjustment) - (event->y - app_data->tree_pan_y));
+        }
+        app_data->tree_pan_x = event->x;
+        app_data->tree_pan_y = event->y;
+        return TRUE;
+    }
+
+    TreeView view;
+    tree_view_get(app_data, &view);
+    if (app_data->tree_is_nary == 0 && app_data->binary_root) {
+        BinaryNode *node = find_clicked_binary_node(app_data, event->x, event->y);
+        if (node) tree_set_hover(app_data, widget, node, view.origin_x + node->x * view.zoom, view.origin_y + node->y * view.zoom);
+        else tree_set_hover(app_data, widget, NULL, 0, 0);
+    } else if (app_data->tree_is_nary == 1 && app_data->nary_root) {
+        NaryNode *node = find_clicked_nary_node(app_data, event->x, event->y);
+        if (node) tree_set_hover(app_data, widget, node, view.origin_x + node->x * view.zoom, view.origin_y + node->y * view.zoom);
+        else tree_set_hover(app_data, widget, NULL, 0, 0);
+    } else {
+        tree_set_hover(app_data, widget, NULL, 0, 0);
+    }
+    return FALSE;
+}
+
+static gboolean on_tree_leave_event(GtkWidget *widget, GdkEventCrossing *event, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    if (app_data) tree_set_hover(app_data, widget, NULL, 0, 0);
+    return FALSE;
+}
+
+static gboolean on_tree_button_release_event(GtkWidget *widget, GdkEventButton *event, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    if (!app_data || event->button != 1) return FALSE;
+    app_data->tree_panning = FALSE;
     return FALSE;
 }
 
+// Molette: défilement vertical (horizontal avec Maj), zoom sous le pointeur avec Ctrl
+static gboolean on_tree_scroll_event(GtkWidget *widget, GdkEventScroll *event, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    if (!app_data || !app_data->tree_hadjustment) return FALSE;
+
+    double dx = 0.0, dy = 0.0;
+    switch (event->direction) {
+        case GDK_SCROLL_UP: dy = -1.0; break;
+        case GDK_SCROLL_DOWN: dy = 1.0; break;
+        case GDK_SCROLL_LEFT: dx = -1.0; break;
+        case GDK_SCROLL_RIGHT: dx = 1.0; break;
+        case GDK_SCROLL_SMOOTH: dx = event->delta_x; dy = event->delta_y; break;
+        default: return FALSE;
+    }
+
+    if (event->state & GDK_CONTROL_MASK) {
+        tree_set_zoom(app_data, app_data->tree_zoom * pow(TREE_ZOOM_STEP, -dy), event->x, event->y);
+        return TRUE;
+    }
+    if (event->state & GDK_SHIFT_MASK) {
+        dx = dy;
+        dy = 0.0;
+    }
+    double step = 60.0;
+    gtk_adjustment_set_value(app_data->tree_hadjustment, gtk_adjustment_get_value(app_data->tree_hadjustment) + dx * step);
+    gtk_adjustment_set_value(app_data->tree_vadjustment, gtk_adjustment_get_value(app_data->tree_vadjustment) + dy * step);
+    return TRUE;
+}
+
+// Défilement par les barres, la molette ou le glisser: les positions à l'écran changent
+static void on_tree_scroll_value_changed(GtkAdjustment *adjustment, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    app_data->tree_hover_node = NULL;
+    if (app_data->tree_drawing_area) gtk_widget_queue_draw(app_data->tree_drawing_area);
+}
+
+static void on_tree_zoom_in_clicked(GtkWidget *widget, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    double width, height;
+    tree_viewport_size(app_data, &width, &height);
+    tree_set_zoom(app_data, app_data->tree_zoom * TREE_ZOOM_STEP, width / 2.0, height / 2.0);
+}
+
+static void on_tree_zoom_out_clicked(GtkWidget *widget, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    double width, height;
+    tree_viewport_size(app_data, &width, &height);
+    tree_set_zoom(app_data, app_data->tree_zoom / TREE_ZOOM_STEP, width / 2.0, height / 2.0);
+}
+
+static void on_tree_zoom_fit_clicked(GtkWidget *widget, gpointer data) {
+    AppData *app_data = (AppData *)data;
+    double width, height;
+    tree_viewport_size(app_data, &width, &height);
+    tree_set_zoom(app_data, tree_zoom_min(app_data), width / 2.0, height / 2.0);
+}
+
 static void on_tree_insert_manual_clicked(GtkWidget *widget, gpointer data) {
     AppData *app_data = (AppData *)data;
 
@@ -6320,17 +11407,21 @@ static void on_tree_insert_manual_clicked(GtkWidget *widget, gpointer data) {
         app_data->nary_max_children = gtk_spin_button_get_value_as_int(app_data->tree_nary_degree_input);
         if (app_data->nary_max_children < 1) app_data->nary_max_children = 1;
     }
-    app_data->tree_is_nary = gtk_combo_box_get_active(GTK_COMBO_BOX(app_data->tree_type_combo));
+    tree_read_type(app_data);
 
     if (app_data->tree_is_nary == 0) {
         int (*cmp)(const void*, const void*) = compare_int;
-        app_data->binary_root = insert_binary(app_data->binary_root, &val, cmp, sizeof(int));
+        app_data->binary_root = insert_binary_balanced(app_data->binary_root, &val, cmp, sizeof(int), app_data->tree_balance);
+        binary_layout_invalidate(app_data);
 
         GtkTextBuffer *buffer = gtk_text_view_get_buffer(app_data->tree_info_view);
         gtk_text_buffer_set_text(buffer, g_strdup_printf("Valeur %d insérée dans l'arbre binaire.", val), -1);
     } else {
         // N-Aire avec respect du degré max
-        app_data->nary_root = insert_nary_random(app_data->nary_root, &val, sizeof(int), app_data->nary_max_children);
+        app_data->nary_root = insert_nary_random(app_data->nary_root, &app_data->nary_frontier, &val, sizeof(int),
+                                                 app_data->nary_max_children);
+        app_data->nary_count++;
+        nary_layout_invalidate(app_data);
 
         GtkTextBuffer *buffer = gtk_text_view_get_buffer(app_data->tree_info_view);
         gtk_text_buffer_set_text(buffer, g_strdup_printf("Valeur %d insérée dans l'arbre N-Aire.", val), -1);
@@ -6338,7 +11429,7 @@ static void on_tree_insert_manual_clicked(GtkWidget *widget, gpointer data) {
 
     if (app_data->tree_manual_entry) gtk_entry_set_text(app_data->tree_manual_entry, "");
     // Forcer le redimensionnement avant le dessin pour les grands arbres
-    g_idle_add((GSourceFunc)update_tree_drawing_area_size, app_data);
+    g_idle_add((GSourceFunc)update_tree_scrollbars, app_data);
     gtk_widget_queue_draw(app_data->tree_drawing_area);
 }
 
@@ -6406,6 +11497,8 @@ static void create_tree_window(GtkWidget *parent_window) {
     app_data->tree_type_combo = GTK_COMBO_BOX_TEXT(gtk_combo_box_text_new());
     gtk_combo_box_text_append_text(app_data->tree_type_combo, "Binaire");
     gtk_combo_box_text_append_text(app_data->tree_type_combo, "N-Aire");
+    gtk_combo_box_text_append_text(app_data->tree_type_combo, "AVL");
+    gtk_combo_box_text_append_text(app_data->tree_type_combo, "Rouge-Noir");
     gtk_combo_box_set_active(GTK_COMBO_BOX(app_data->tree_type_combo), 0);
     // Style CSS activé
     gtk_style_context_add_class(gtk_widget_get_style_context(GTK_WIDGET(app_data->tree_type_combo)), "modern-combo");
@@ -6425,7 +11518,7 @@ static void create_tree_window(GtkWidget *parent_window) {
     GtkWidget *hbox_size = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 10);
     gtk_box_pack_start(GTK_BOX(config_card), hbox_size, FALSE, FALSE, 0);
     gtk_box_pack_start(GTK_BOX(hbox_size), gtk_label_new("Nombre:"), FALSE, FALSE, 0);
-    app_data->tree_size_input = GTK_SPIN_BUTTON(gtk_spin_button_new_with_range(1, 10000, 1));
+    app_data->tree_size_input = GTK_SPIN_BUTTON(gtk_spin_button_new_with_range(1, 1000000, 1));
     gtk_spin_button_set_value(GTK_SPIN_BUTTON(app_data->tree_size_input), 50);
     // Style CSS activé
     gtk_style_context_add_class(gtk_widget_get_style_context(GTK_WIDGET(app_data->tree_size_input)), "modern-spin");
@@ -6550,6 +11643,29 @@ static void create_tree_window(GtkWidget *parent_window) {
     g_signal_connect(btn_stats, "clicked", G_CALLBACK(on_tree_stats_clicked), app_data);
     gtk_box_pack_start(GTK_BOX(actions_card), btn_stats, FALSE, FALSE, 0);
 
+    // Statistiques d'ordre (arbres binaires de recherche)
+    GtkWidget *lbl_order_stats = gtk_label_new("Statistiques d'ordre");
+    gtk_label_set_markup(GTK_LABEL(lbl_order_stats), "<span foreground='#ffffff' size='large' weight='bold'>📐 Statistiques d'ordre</span>");
+    gtk_box_pack_start(GTK_BOX(actions_card), lbl_order_stats, FALSE, FALSE, 10);
+
+    GtkWidget *btn_select = gtk_button_new_with_label("🔢 k-ième plus petit");
+    // Style CSS activé
+    gtk_style_context_add_class(gtk_widget_get_style_context(btn_select), "modern-button");
+    g_signal_connect(btn_select, "clicked", G_CALLBACK(on_tree_select_clicked), app_data);
+    gtk_box_pack_start(GTK_BOX(actions_card), btn_select, FALSE, FALSE, 0);
+
+    GtkWidget *btn_rank = gtk_button_new_with_label("🏅 Rang d'une valeur");
+    // Style CSS activé
+    gtk_style_context_add_class(gtk_widget_get_style_context(btn_rank), "modern-button");
+    g_signal_connect(btn_rank, "clicked", G_CALLBACK(on_tree_rank_clicked), app_data);
+    gtk_box_pack_start(GTK_BOX(actions_card), btn_rank, FALSE, FALSE, 0);
+
+    GtkWidget *btn_range = gtk_button_new_with_label("📏 Compter dans [a, b]");
+    // Style CSS activé
+    gtk_style_context_add_class(gtk_widget_get_style_context(btn_range), "modern-button");
+    g_signal_connect(btn_range, "clicked", G_CALLBACK(on_tree_range_count_clicked), app_data);
+    gtk_box_pack_start(GTK_BOX(actions_card), btn_range, FALSE, FALSE, 0);
+
     GtkWidget *btn_order = gtk_button_new_with_label("🔀 Ordonner Arbre");
     gtk_style_context_add_class(gtk_widget_get_style_context(btn_order), "modern-button");
     g_signal_connect(btn_order, "clicked", G_CALLBACK(on_tree_order_clicked), app_data);
@@ -6561,6 +11677,29 @@ static void create_tree_window(GtkWidget *parent_window) {
     g_signal_connect(btn_trans, "clicked", G_CALLBACK(on_tree_transform_clicked), app_data);
     gtk_box_pack_start(GTK_BOX(actions_card), btn_trans, FALSE, FALSE, 0);
 
+    // Zoom de la visualisation (aussi Ctrl + molette sous le pointeur)
+    GtkWidget *lbl_zoom = gtk_label_new("Zoom");
+    gtk_label_set_markup(GTK_LABEL(lbl_zoom), "<span foreground='#ffffff' size='large' weight='bold'>🔍 Zoom</span>");
+    gtk_box_pack_start(GTK_BOX(actions_card), lbl_zoom, FALSE, FALSE, 10);
+
+    GtkWidget *btn_zoom_in = gtk_button_new_with_label("➕ Zoom Avant");
+    // Style CSS activé
+    gtk_style_context_add_class(gtk_widget_get_style_context(btn_zoom_in), "modern-button");
+    g_signal_connect(btn_zoom_in, "clicked", G_CALLBACK(on_tree_zoom_in_clicked), app_data);
+    gtk_box_pack_start(GTK_BOX(actions_card), btn_zoom_in, FALSE, FALSE, 0);
+
+    GtkWidget *btn_zoom_out = gtk_button_new_with_label("➖ Zoom Arrière");
+    // Style CSS activé
+    gtk_style_context_add_class(gtk_widget_get_style_context(btn_zoom_out), "modern-button");
+    g_signal_connect(btn_zoom_out, "clicked", G_CALLBACK(on_tree_zoom_out_clicked), app_data);
+    gtk_box_pack_start(GTK_BOX(actions_card), btn_zoom_out, FALSE, FALSE, 0);
+
+    GtkWidget *btn_zoom_fit = gtk_button_new_with_label("🖼️ Arbre Entier");
+    // Style CSS activé
+    gtk_style_context_add_class(gtk_widget_get_style_context(btn_zoom_fit), "modern-button");
+    g_signal_connect(btn_zoom_fit, "clicked", G_CALLBACK(on_tree_zoom_fit_clicked), app_data);
+    gtk_box_pack_start(GTK_BOX(actions_card), btn_zoom_fit, FALSE, FALSE, 0);
+
     gtk_box_pack_start(GTK_BOX(hbox), control_scrolled, FALSE, FALSE, 0);
 
     // ========== PANEL DROIT : AFFICHAGE DES RÉSULTATS MODERNES ==========
@@ -6585,24 +11724,34 @@ static void create_tree_window(GtkWidget *parent_window) {
     gtk_label_set_markup(GTK_LABEL(drawing_header), "<span foreground='#ffffff' size='large' weight='bold'>🌳 Visualisation de l'Arbre</span>");
     gtk_box_pack_start(GTK_BOX(drawing_card), drawing_header, FALSE, FALSE, 0);
 
-    // Créer un scrolled window pour le drawing_area
-    GtkWidget *scrolled_window = gtk_scrolled_window_new(NULL, NULL);
-    gtk_scrolled_window_set_policy(GTK_SCROLLED_WINDOW(scrolled_window),
-                                    GTK_POLICY_AUTOMATIC, GTK_POLICY_AUTOMATIC);
-    gtk_widget_set_size_request(scrolled_window, -1, 450);
-    gtk_scrolled_window_set_shadow_type(GTK_SCROLLED_WINDOW(scrolled_window), GTK_SHADOW_IN);
-    app_data->tree_scrolled_window = scrolled_window;
+    // Zone de dessin à défilement virtuel: elle garde la taille de la fenêtre et les barres
+    // de défilement couvrent l'arbre entier à l'échelle courante (aucune limite de taille)
+    GtkWidget *view_grid = gtk_grid_new();
+    gtk_widget_set_size_request(view_grid, -1, 450);
+    app_data->tree_zoom = 1.0;
+    app_data->tree_hadjustment = gtk_adjustment_new(0.0, 0.0, 1.0, 40.0, 400.0, 1.0);
+    app_data->tree_vadjustment = gtk_adjustment_new(0.0, 0.0, 1.0, 40.0, 400.0, 1.0);
+    g_signal_connect(app_data->tree_hadjustment, "value-changed", G_CALLBACK(on_tree_scroll_value_changed), app_data);
+    g_signal_connect(app_data->tree_vadjustment, "value-changed", G_CALLBACK(on_tree_scroll_value_changed), app_data);
 
     GtkWidget *drawing_area = gtk_drawing_area_new();
-    gtk_widget_set_size_request(drawing_area, 800, 600);
+    gtk_widget_set_hexpand(drawing_area, TRUE);
+    gtk_widget_set_vexpand(drawing_area, TRUE);
     app_data->tree_drawing_area = drawing_area;
-    // Enable events for Click-to-Edit
-    gtk_widget_add_events(drawing_area, GDK_BUTTON_PRESS_MASK);
+    // Enable events for Click-to-Edit, survol des nœuds, glisser et molette (Ctrl: zoom)
+    gtk_widget_add_events(drawing_area, GDK_BUTTON_PRESS_MASK | GDK_BUTTON_RELEASE_MASK | GDK_POINTER_MOTION_MASK |
+                                        GDK_LEAVE_NOTIFY_MASK | GDK_SCROLL_MASK | GDK_SMOOTH_SCROLL_MASK);
     g_signal_connect(drawing_area, "draw", G_CALLBACK(draw_tree_callback), app_data);
     g_signal_connect(drawing_area, "button-press-event", G_CALLBACK(on_tree_click_event), app_data);
+    g_signal_connect(drawing_area, "button-release-event", G_CALLBACK(on_tree_button_release_event), app_data);
+    g_signal_connect(drawing_area, "motion-notify-event", G_CALLBACK(on_tree_motion_event), app_data);
+    g_signal_connect(drawing_area, "leave-notify-event", G_CALLBACK(on_tree_leave_event), app_data);
+    g_signal_connect(drawing_area, "scroll-event", G_CALLBACK(on_tree_scroll_event), app_data);
 
-    gtk_container_add(GTK_CONTAINER(scrolled_window), drawing_area);
-    gtk_box_pack_start(GTK_BOX(drawing_card), scrolled_window, TRUE, TRUE, 0);
+    gtk_grid_attach(GTK_GRID(view_grid), drawing_area, 0, 0, 1, 1);
+    gtk_grid_attach(GTK_GRID(view_grid), gtk_scrollbar_new(GTK_ORIENTATION_VERTICAL, app_data->tree_vadjustment), 1, 0, 1, 1);
+    gtk_grid_attach(GTK_GRID(view_grid), gtk_scrollbar_new(GTK_ORIENTATION_HORIZONTAL, app_data->tree_hadjustment), 0, 1, 1, 1);
+    gtk_box_pack_start(GTK_BOX(drawing_card), view_grid, TRUE, TRUE, 0);
 
     // Zone d'Informations (Carte moderne)
     GtkWidget *info_card = gtk_box_new(GTK_ORIENTATION_VERTICAL, 10);
@@ -6627,6 +11776,9 @@ static void create_tree_window(GtkWidget *parent_window) {
     // Gestionnaire pour la fermeture de la fenêtre secondaire
     g_signal_connect(window, "delete-event", G_CALLBACK(on_secondary_window_delete), NULL);
 
+    // Nettoyage à la destruction de la fenêtre (arbres et disposition en cache)
+    g_signal_connect(window, "destroy", G_CALLBACK(on_tree_window_destroy), app_data);
+
     gtk_widget_show_all(window);
 }
 
@@ -7397,6 +12549,26 @@ static void on_list_window_destroy(GtkWidget *widget, gpointer user_data) {
         if (app_data->current_list) {
             list_free(app_data->current_list);
         }
+        if (app_data->list_secondary) {
+            list_free(app_data->list_secondary);
+        }
+        if (app_data->list_history) {
+            list_history_clear(app_data->list_history);
+            g_free(app_data->list_history);
+        }
+        g_free(app_data);
+    }
+}
+
+static void on_tree_window_destroy(GtkWidget *widget, gpointer user_data) {
+    AppData *app_data = (AppData *)user_data;
+    if (app_data) {
+        free_binary_tree(app_data->binary_root);
+        free_nary_tree(app_data->nary_root);
+        g_free(app_data->binary_layout_nodes);
+        g_free(app_data->nary_layout_nodes);
+        g_free(app_data->nary_layout_row_start);
+        nary_frontier_free(&app_data->nary_frontier);
         g_free(app_data);
     }
 }